@@ -0,0 +1,316 @@
+#!/usr/bin/env python3
+#======== ======== ======== ======== ======== ======== ======== ========
+#	Copyright (c) Tiago Miguel Oliveira Freire
+#
+#	Permission is hereby granted, free of charge, to any person obtaining a copy
+#	of this software and associated documentation files (the "Software"), to deal
+#	in the Software without restriction, including without limitation the rights
+#	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+#	copies of the Software, and to permit persons to whom the Software is
+#	furnished to do so, subject to the following conditions:
+#
+#	The above copyright notice and this permission notice shall be included in all
+#	copies or substantial portions of the Software.
+#
+#	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+#	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+#	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+#	SOFTWARE.
+#======== ======== ======== ======== ======== ======== ======== ========
+
+"""Compile-time benchmark of the unit template machinery.
+
+Generates translation units that instantiate an increasing number of unit types,
+with increasing dimension pack sizes, for each scenario (make_unit, metric_multiply,
+metric_divide, dimension_merge_clober). Every unit is compiled with every requested
+compiler and the wall time, peak resident memory and the compiler's own time
+breakdown (-ftime-trace for Clang, -ftime-report for GCC) are recorded.
+
+Results are written as json and can be compared against a previous run with
+--baseline, any case slower or heavier than the tolerance fails the run.
+"""
+
+import argparse
+import itertools
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+
+SCRIPT_DIR		= os.path.dirname(os.path.abspath(__file__))
+UNIT_INCLUDE	= os.path.normpath(os.path.join(SCRIPT_DIR, '..', '..', 'include'))
+
+SCENARIOS = ('make_unit', 'metric_multiply', 'metric_divide', 'dimension_merge_clober')
+
+#one entry per metric, SI standard first, followed by units that force conversions
+METRIC_POOL = (
+	('radian', 'degree'),
+	('coloumb',),
+	('bit', 'byte'),
+	('metre', 'foot', 'mile'),
+	('candela',),
+	('si_mass', 'pound_av'),
+	('kelvin', 'rankine'),
+	('second', 'hour'),
+)
+
+RANKS	= (1, -1, 2, -2)
+POWERS	= (1, -1, 2, -2, 3, -3, 4, -4, 5, -5, 6, -6)
+
+PREAMBLE = '''#include <CoreLib/core_pack.hpp>
+
+#include <unit/_p/unit_type.hpp>
+#include <unit/standard/multipliers.hpp>
+#include <unit/standard/standard_angle.hpp>
+#include <unit/standard/standard_charge.hpp>
+#include <unit/standard/standard_digital.hpp>
+#include <unit/standard/standard_lenght.hpp>
+#include <unit/standard/standard_luminosity.hpp>
+#include <unit/standard/standard_mass.hpp>
+#include <unit/standard/standard_temperature.hpp>
+#include <unit/standard/standard_time.hpp>
+
+namespace bench
+{
+using namespace ::unit;
+
+'''
+
+
+#======== ======== Generation ======== ========
+
+def unit_definitions(p_count, p_pack_size, p_mixed):
+	"""Yields p_count distinct make_unit expressions, each with p_pack_size dimensions given out of order."""
+	seen = set()
+	for k in itertools.count():
+		t_index = k
+		t_power_e = POWERS[t_index % len(POWERS)]; t_index //= len(POWERS)
+		t_power_b = POWERS[t_index % len(POWERS)]; t_index //= len(POWERS)
+		t_offset = t_index % len(METRIC_POOL); t_index //= len(METRIC_POOL)
+
+		t_dims = []
+		for j in range(p_pack_size):
+			t_metric = METRIC_POOL[(t_offset + j) % len(METRIC_POOL)]
+			t_rank = RANKS[t_index % len(RANKS)]; t_index //= len(RANKS)
+			t_standard = t_metric[(k + j) % len(t_metric)] if p_mixed else t_metric[0]
+			t_dims.append(f'_p::dimension<standard::{t_standard}, {t_rank}>')
+
+		t_dims.reverse()
+		t_text = (f'make_unit<double, core::pack<{", ".join(t_dims)}>, '
+			f'core::pack<_p::scalar<multi::E, {t_power_e}>, _p::scalar<multi::bi, {t_power_b}>>>::type')
+
+		if t_text in seen:
+			if k > p_count * 64:
+				raise RuntimeError(f'unable to generate {p_count} distinct units with pack size {p_pack_size}')
+			continue
+
+		seen.add(t_text)
+		yield t_text
+		if len(seen) == p_count:
+			return
+
+
+def generate_source(p_scenario, p_count, p_pack_size, p_mixed):
+	t_lines = [PREAMBLE]
+	for i, t_definition in enumerate(unit_definitions(p_count, p_pack_size, p_mixed)):
+		t_lines.append(f'using u{i} = {t_definition};\n')
+		t_lines.append(f'static_assert(sizeof(u{i}) == sizeof(double));\n')
+	t_lines.append('\n')
+
+	for i in range(p_count - 1):
+		if p_scenario == 'metric_multiply':
+			t_lines.append(f'auto op{i}(const u{i}& p_1, const u{i + 1}& p_2) {{ return p_1 * p_2; }}\n')
+		elif p_scenario == 'metric_divide':
+			t_lines.append(f'auto op{i}(const u{i}& p_1, const u{i + 1}& p_2) {{ return p_1 / p_2; }}\n')
+		elif p_scenario == 'dimension_merge_clober':
+			t_lines.append(
+				f'using op{i} = _p::dimension_merge_clober<u{i}::unit_pack::dimension_pack, u{i + 1}::unit_pack::dimension_pack>::type;\n'
+				f'static_assert(core::pack_count_v<op{i}> <= {2 * p_pack_size});\n')
+
+	t_lines.append('\n} //namespace bench\n')
+	return ''.join(t_lines)
+
+
+#======== ======== Measurement ======== ========
+
+def compiler_family(p_compiler):
+	t_version = subprocess.run([p_compiler, '--version'], capture_output=True, text=True).stdout
+	return 'clang' if 'clang' in t_version else 'gcc'
+
+
+def run_measured(p_command, p_stderr_path):
+	"""Runs a command, returning (wall seconds, peak resident KiB, exit code)."""
+	with open(p_stderr_path, 'w') as t_stderr:
+		t_start = time.perf_counter()
+		t_process = subprocess.Popen(p_command, stdout=subprocess.DEVNULL, stderr=t_stderr)
+		_, t_status, t_usage = os.wait4(t_process.pid, 0)
+		t_wall = time.perf_counter() - t_start
+	t_process.returncode = os.waitstatus_to_exitcode(t_status)
+	return t_wall, t_usage.ru_maxrss, t_process.returncode
+
+
+def summarize_clang_trace(p_trace_path, p_top):
+	with open(p_trace_path) as t_file:
+		t_events = json.load(t_file).get('traceEvents', [])
+
+	t_totals = {}
+	for t_event in t_events:
+		t_name = t_event.get('name', '')
+		if t_name.startswith('Total ') and 'dur' in t_event:
+			t_totals[t_name[6:]] = t_totals.get(t_name[6:], 0.0) + t_event['dur'] / 1000.0
+	return dict(sorted(t_totals.items(), key=lambda p: -p[1])[:p_top])
+
+
+GCC_REPORT_LINE = re.compile(r'^\s*(.+?)\s*:\s*[\d.]+\s*\(\s*\d+%\)\s*[\d.]+\s*\(\s*\d+%\)\s*([\d.]+)\s*\(')
+
+def summarize_gcc_report(p_report_path, p_top):
+	t_totals = {}
+	with open(p_report_path) as t_file:
+		for t_line in t_file:
+			t_match = GCC_REPORT_LINE.match(t_line)
+			if t_match and not t_match.group(1).startswith('TOTAL'):
+				t_totals[t_match.group(1)] = float(t_match.group(2)) * 1000.0
+	return dict(sorted(t_totals.items(), key=lambda p: -p[1])[:p_top])
+
+
+def measure(p_args, p_compiler, p_family, p_source_path, p_work_dir, p_repeat):
+	t_base = os.path.splitext(p_source_path)[0]
+	t_object = t_base + '.o'
+	t_stderr = t_base + '.' + p_family + '.log'
+
+	t_command = [p_compiler, '-std=c++20', p_args.opt, '-c', p_source_path, '-o', t_object,
+		'-I', UNIT_INCLUDE, '-I', p_args.corelib, '-I', p_args.mathlib]
+	t_command += p_args.extra_flag
+
+	t_walls = []
+	t_peak = 0
+	for _ in range(p_repeat):
+		t_wall, t_rss, t_code = run_measured(t_command, t_stderr)
+		if t_code != 0:
+			with open(t_stderr) as t_file:
+				sys.stderr.write(t_file.read())
+			raise RuntimeError(f'compilation failed: {" ".join(t_command)}')
+		t_walls.append(t_wall)
+		t_peak = max(t_peak, t_rss)
+
+	#the breakdown run is separate, so that tracing overhead does not affect the timings
+	if p_family == 'clang':
+		t_trace_flags = ['-ftime-trace', f'-ftime-trace-granularity={p_args.trace_granularity}']
+	else:
+		t_trace_flags = ['-ftime-report']
+	run_measured(t_command + t_trace_flags, t_stderr)
+
+	if p_family == 'clang':
+		t_trace = t_base + '.json'
+		t_breakdown = summarize_clang_trace(t_trace, p_args.top) if os.path.exists(t_trace) else {}
+	else:
+		t_trace = t_stderr
+		t_breakdown = summarize_gcc_report(t_stderr, p_args.top)
+
+	return {
+		'wall_s':			min(t_walls),
+		'wall_median_s':	sorted(t_walls)[len(t_walls) // 2],
+		'peak_rss_kib':		t_peak,
+		'breakdown_ms':		t_breakdown,
+		'trace':			os.path.relpath(t_trace, p_work_dir),
+	}
+
+
+#======== ======== Regression check ======== ========
+
+def case_key(p_result):
+	return (p_result['compiler'], p_result['scenario'], p_result['count'], p_result['pack_size'], p_result['mixed'])
+
+
+def compare(p_results, p_baseline_path, p_tolerance):
+	with open(p_baseline_path) as t_file:
+		t_baseline = {case_key(r): r for r in json.load(t_file)['results']}
+
+	t_regressions = []
+	for t_result in p_results:
+		t_old = t_baseline.get(case_key(t_result))
+		if t_old is None:
+			continue
+		for t_metric in ('wall_s', 'peak_rss_kib'):
+			t_ratio = t_result[t_metric] / t_old[t_metric] if t_old[t_metric] else 1.0
+			t_result[t_metric + '_ratio'] = t_ratio
+			if t_ratio > 1.0 + p_tolerance:
+				t_regressions.append((case_key(t_result), t_metric, t_old[t_metric], t_result[t_metric], t_ratio))
+	return t_regressions
+
+
+#======== ======== Main ======== ========
+
+def parse_list(p_text):
+	return [int(x) for x in p_text.split(',') if x]
+
+
+def main():
+	t_parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+	t_parser.add_argument('--corelib',		required=True, help='include directory containing CoreLib/')
+	t_parser.add_argument('--mathlib',		required=True, help='include directory containing MathLib/')
+	t_parser.add_argument('--compiler',		action='append', help='compiler to benchmark, may be repeated (default: g++ and clang++ when available)')
+	t_parser.add_argument('--scenario',		action='append', choices=SCENARIOS, help='scenario to run, may be repeated (default: all)')
+	t_parser.add_argument('--counts',		default='16,64,256', help='comma separated number of unit types per unit')
+	t_parser.add_argument('--pack-sizes',	default='1,2,4,8', help='comma separated number of dimensions per unit type')
+	t_parser.add_argument('--mixed',		action='store_true', help='mix non SI units, exercising the conflicting unit paths')
+	t_parser.add_argument('--repeat',		type=int, default=3, help='timed compilations per case, the fastest is reported')
+	t_parser.add_argument('--opt',			default='-O2', help='optimization flag')
+	t_parser.add_argument('--extra-flag',	action='append', default=[], help='additional compiler flag, may be repeated')
+	t_parser.add_argument('--trace-granularity', type=int, default=100, help='clang -ftime-trace granularity in microseconds')
+	t_parser.add_argument('--top',			type=int, default=12, help='number of breakdown entries kept per case')
+	t_parser.add_argument('--work-dir',		help='where the generated units and traces are kept (default: temporary)')
+	t_parser.add_argument('--output',		default='compile_time_results.json', help='results file')
+	t_parser.add_argument('--baseline',		help='previous results to compare against')
+	t_parser.add_argument('--tolerance',	type=float, default=0.10, help='allowed relative increase over the baseline')
+	t_args = t_parser.parse_args()
+
+	t_compilers = t_args.compiler or [c for c in ('g++', 'clang++') if shutil.which(c)]
+	t_scenarios = t_args.scenario or list(SCENARIOS)
+
+	t_work_dir = t_args.work_dir or tempfile.mkdtemp(prefix='unit_compile_time_')
+	os.makedirs(t_work_dir, exist_ok=True)
+
+	t_results = []
+	for t_compiler in t_compilers:
+		t_family = compiler_family(t_compiler)
+		for t_scenario, t_pack_size, t_count in itertools.product(t_scenarios, parse_list(t_args.pack_sizes), parse_list(t_args.counts)):
+			t_source = os.path.join(t_work_dir, f'{t_scenario}_p{t_pack_size}_n{t_count}{"_mixed" if t_args.mixed else ""}_{t_family}.cpp')
+			with open(t_source, 'w') as t_file:
+				t_file.write(generate_source(t_scenario, t_count, t_pack_size, t_args.mixed))
+
+			t_result = {
+				'compiler':		t_compiler,
+				'family':		t_family,
+				'scenario':		t_scenario,
+				'count':		t_count,
+				'pack_size':	t_pack_size,
+				'mixed':		t_args.mixed,
+			}
+			t_result.update(measure(t_args, t_compiler, t_family, t_source, t_work_dir, t_args.repeat))
+			t_results.append(t_result)
+
+			print(f'{t_compiler:>10} {t_scenario:>24} pack {t_pack_size:>2} units {t_count:>5}: '
+				f'{t_result["wall_s"]:8.3f} s {t_result["peak_rss_kib"] / 1024.0:9.1f} MiB', flush=True)
+
+	t_regressions = compare(t_results, t_args.baseline, t_args.tolerance) if t_args.baseline else []
+
+	with open(t_args.output, 'w') as t_file:
+		json.dump({'work_dir': t_work_dir, 'results': t_results}, t_file, indent='\t')
+
+	for t_key, t_metric, t_old, t_new, t_ratio in t_regressions:
+		print(f'REGRESSION {t_key} {t_metric}: {t_old} -> {t_new} ({(t_ratio - 1.0) * 100.0:+.1f}%)')
+
+	return 1 if t_regressions else 0
+
+
+if __name__ == '__main__':
+	sys.exit(main())
@@ -0,0 +1,150 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include <CoreLib/core_pack.hpp>
+
+#include "dimension.hpp"
+#include "metric_pack.hpp"
+#include "../standard/standard_angle.hpp"
+#include "../standard/standard_charge.hpp"
+#include "../standard/standard_digital.hpp"
+#include "../standard/standard_lenght.hpp"
+#include "../standard/standard_luminosity.hpp"
+#include "../standard/standard_mass.hpp"
+#include "../standard/standard_temperature.hpp"
+#include "../standard/standard_time.hpp"
+
+namespace unit::_p
+{
+
+//======== ======== Metric lanes ======== ========
+
+/// \brief Number of metrics that fit in a dynamic signature
+inline constexpr uint8_t dynamic_lane_count = 8;
+
+/// \brief Lane of a metric in a dynamic signature
+/// \note Only the metrics in standard have a lane, metrics without one can not be represented at runtime
+template<c_metric_t Metric>
+struct dynamic_lane;
+
+template<> struct dynamic_lane<standard::angle_metric>			: std::integral_constant<uint8_t, 0> {};
+template<> struct dynamic_lane<standard::charge_metric>			: std::integral_constant<uint8_t, 1> {};
+template<> struct dynamic_lane<standard::digital_info_metric>	: std::integral_constant<uint8_t, 2> {};
+template<> struct dynamic_lane<standard::lenght_metric>			: std::integral_constant<uint8_t, 3> {};
+template<> struct dynamic_lane<standard::luminosity_metric>		: std::integral_constant<uint8_t, 4> {};
+template<> struct dynamic_lane<standard::mass_metric>			: std::integral_constant<uint8_t, 5> {};
+template<> struct dynamic_lane<standard::temperature_metric>	: std::integral_constant<uint8_t, 6> {};
+template<> struct dynamic_lane<standard::time_metric>			: std::integral_constant<uint8_t, 7> {};
+
+template<c_metric_t Metric>
+inline constexpr uint8_t dynamic_lane_v = dynamic_lane<Metric>::value;
+
+template<typename Metric>
+concept c_dynamic_metric = requires { dynamic_lane<Metric>::value; };
+
+static_assert(dynamic_lane_count * 8 == 64, "All lanes must fit in a 64 bit word");
+
+
+//======== ======== Dynamic signature ======== ========
+
+/// \brief Rank of every metric packed into a single word, one signed 8 bit lane per metric
+/// \note Lanes are added and subtracted in parallel within the word (SWAR), without carries crossing from one lane to the next.
+///	Ranks have the same range as the rank of a static dimension, results outside of it wrap around.
+class dynamic_signature
+{
+private:
+	static constexpr uint64_t sign_mask = 0x8080808080808080;
+
+public:
+	inline constexpr dynamic_signature(): m_word{0} {}
+	inline explicit constexpr dynamic_signature(uint64_t p_word): m_word{p_word} {}
+
+	/// \brief Signature with a single metric
+	static inline constexpr dynamic_signature from_rank(uint8_t p_lane, int8_t p_rank)
+	{
+		return dynamic_signature{static_cast<uint64_t>(static_cast<uint8_t>(p_rank)) << (p_lane * 8)};
+	}
+
+	inline constexpr int8_t rank(uint8_t p_lane) const
+	{
+		return static_cast<int8_t>(static_cast<uint8_t>(m_word >> (p_lane * 8)));
+	}
+
+	inline constexpr uint64_t word() const { return m_word; }
+	inline constexpr bool dimensionless() const { return m_word == 0; }
+
+	/// \brief Signature of the product, ranks are added
+	inline constexpr dynamic_signature operator * (dynamic_signature p_other) const
+	{
+		return dynamic_signature{((m_word & ~sign_mask) + (p_other.m_word & ~sign_mask)) ^ ((m_word ^ p_other.m_word) & sign_mask)};
+	}
+
+	/// \brief Signature of the quotient, ranks are subtracted
+	inline constexpr dynamic_signature operator / (dynamic_signature p_other) const
+	{
+		return dynamic_signature{((m_word | sign_mask) - (p_other.m_word & ~sign_mask)) ^ ((m_word ^ ~p_other.m_word) & sign_mask)};
+	}
+
+	inline constexpr dynamic_signature inverse() const
+	{
+		return dynamic_signature{} / *this;
+	}
+
+	inline constexpr bool operator == (const dynamic_signature&) const = default;
+
+private:
+	uint64_t m_word;
+};
+
+
+//======== ======== Static to dynamic ======== ========
+
+template<typename Pack>
+struct is_dynamic_dimension_pack: std::false_type {};
+
+template<c_dimension... Dimensions>
+struct is_dynamic_dimension_pack<core::pack<Dimensions...>>: std::bool_constant<(c_dynamic_metric<typename Dimensions::metric_t> && ...)> {};
+
+/// \brief unit packs whose every metric has a lane
+template<typename Pack>
+concept c_dynamic_unit_pack = c_unit_pack<Pack> && is_dynamic_dimension_pack<typename Pack::dimension_pack>::value;
+
+template<c_dimension... Dimensions>
+consteval dynamic_signature make_dynamic_signature(core::pack<Dimensions...>*)
+{
+	//the same metric may appear more than once with different standards
+	return (dynamic_signature{} * ... * dynamic_signature::from_rank(dynamic_lane_v<typename Dimensions::metric_t>, Dimensions::rank));
+}
+
+/// \brief Dynamic signature of a static unit pack
+template<c_dynamic_unit_pack Pack>
+inline constexpr dynamic_signature dynamic_signature_v = make_dynamic_signature(static_cast<typename Pack::dimension_pack*>(nullptr));
+
+} //namespace unit::_p
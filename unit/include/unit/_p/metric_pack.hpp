@@ -26,9 +26,11 @@
 #pragma once
 
 #include "utils.hpp"
+#include "unit_fwd.hpp"
 #include "dimension.hpp"
 
 #include "metric_type.hpp"
+#include "signature.hpp"
 
 namespace unit::_p
 {
@@ -50,85 +52,50 @@ public:
 	static_assert(core::pack_count_v<dimension_pack> != 0, "Dimension pack must not be empty");
 
 	static constexpr long double gauge = pack_multiply<dimension_pack, get_factor>::value * pack_multiply<scalar_pack, get_factor>::value;
-};
-
-
-
 
+	/// \brief value form of the unit, for constexpr evaluation
+	static constexpr auto signature = unit_signature_v<dimension_pack, scalar_pack>;
+};
 
-template<typename> struct is_unit_pack : public std::false_type {};
-template<typename ...Type> struct is_unit_pack<unit_pack<Type...>> : public std::true_type{};
-
-template<typename T>
-constexpr bool is_unit_pack_v = is_unit_pack<T>::value;
-
-template<typename T>
-concept c_unit_pack = is_unit_pack_v<T>;
 
 
 /// \brief checks if 2 packs have the same type of dimensions
 template<core::c_pack Pack1, core::c_pack Pack2>
 struct compatible_pack
 {
-private:
-	static constexpr uintptr_t pack1_size = core::pack_count_v<Pack1>;
-	static constexpr uintptr_t pack2_size = core::pack_count_v<Pack2>;
+	static constexpr bool value = compatible_dimensions_v<paired_dimension_entries_v<Pack1, Pack2>, paired_dimension_entries_v<Pack2, Pack1>>;
+};
 
-	template<uintptr_t Index = 0>
-	static constexpr bool match_all()
-	{
-		if constexpr (Index >= pack1_size)
-		{
-			return true;
-		}
-		else
-		{
-			using dim1 = core::pack_get_t<Pack1, Index>;
-			using dim2 = core::pack_get_t<Pack1, Index>;
-
-			if constexpr (
-				compare_equal_metric_v<typename dim1::metric_t, typename dim2::metric_t>
-				&& dim1::rank == dim2::rank)
-			{
-				return match_all<Index + 1>();
-			}
-			else
-			{
-				return false;
-			}
-		}
-	}
 
-	static constexpr bool check()
-	{
-		if constexpr (pack1_size == pack2_size)
-		{
-			return match_all();
-		}
-		else
-		{
-			return false;
-		}
-	}
+template<c_unit_pack Pack1, c_unit_pack Pack2>
+using is_compatible_unit_pack = compatible_pack<typename Pack1::dimension_pack, typename Pack2::dimension_pack>;
 
-public:
-	static constexpr bool value = check();
+/// \brief how a value of one unit pack relates to a value of another
+enum class conversion_kind: uint8_t
+{
+	incompatible,		//!< dimensions do not match
+	interchangeable,	//!< dimensions and gauge match, the value can be used as is
+	convertible,		//!< dimensions match but the gauge differs, the value needs to be scaled
 };
 
-
+/// \brief relation between 2 unit packs, evaluated once per pair
+/// \note Unit operators constrain on this trait and dispatch on it with if constexpr,
+///	so that overload resolution does not have to evaluate a pair of mutually exclusive constraints per candidate
 template<c_unit_pack Pack1, c_unit_pack Pack2>
-using is_compatible_unit_pack = compatible_pack<typename Pack1::dimension_pack, typename Pack2::dimension_pack>;
+inline constexpr conversion_kind conversion_kind_v =
+	!is_compatible_unit_pack<Pack1, Pack2>::value ? conversion_kind::incompatible :
+	Pack1::gauge == Pack2::gauge ? conversion_kind::interchangeable : conversion_kind::convertible;
 
 template<typename Pack1, typename Pack2>
-concept c_compatible_unit_pack = is_compatible_unit_pack<Pack1, Pack2>::value;
+concept c_compatible_unit_pack = conversion_kind_v<Pack1, Pack2> != conversion_kind::incompatible;
 
 /// \brief packs are not only compatible, they have the same gauge
 template<typename Pack1, typename Pack2>
-concept c_interchangeable_unit_pack = is_compatible_unit_pack<Pack1, Pack2>::value && Pack1::gauge == Pack2::gauge;
+concept c_interchangeable_unit_pack = conversion_kind_v<Pack1, Pack2> == conversion_kind::interchangeable;
 
 /// \brief packs are only compatible and do not have the same gauge
 template<typename Pack1, typename Pack2>
-concept c_weak_compatible_unit_pack = is_compatible_unit_pack<Pack1, Pack2>::value && Pack1::gauge != Pack2::gauge;
+concept c_weak_compatible_unit_pack = conversion_kind_v<Pack1, Pack2> == conversion_kind::convertible;
 
 
 /// \brief inverts a pack with either dimension or scalar
@@ -144,52 +111,59 @@ struct inverse_pack
 template<core::c_pack Pack1, core::c_pack Pack2>
 struct has_conflicting_units
 {
-private:
-	static constexpr uintptr_t pack1_size = core::pack_count_v<Pack1>;
-	static constexpr uintptr_t pack2_size = core::pack_count_v<Pack2>;
+	static constexpr bool value = conflicting_dimensions_v<paired_dimension_entries_v<Pack1, Pack2>, paired_dimension_entries_v<Pack2, Pack1>>;
+};
 
-	template<uintptr_t Index1 = 0, uintptr_t Index2 = 0>
-	static constexpr bool check()
-	{
-		if constexpr (Index1 < pack1_size && Index2 < pack2_size)
-		{
-			using type1 = typename core::pack_get_t<Pack1, Index1>;
-			using type2 = typename core::pack_get_t<Pack2, Index2>;
-			if constexpr(
-				compare_equal_metric_v<typename type1::metric_t, typename type2::metric_t>
-				)
-			{
-				if constexpr(std::is_same_v<typename type1::standard_t, typename type2::standard_t>)
-				{
-					return check<Index1 + 1, Index2 + 1>();
-				}
-				else
-				{
-					return true;
-				}
-			}
-			else
-			{
-				if constexpr(
-					compare_less_metric_v<typename type1::metric_t, typename type2::metric_t>
-					)
-				{
-					return check<Index1 + 1, Index2>();
-				}
-				else
-				{
-					return check<Index1, Index2 + 1>();
-				}
-			}
-		}
-		else
-		{
-			return false;
-		}
-	}
+
+//======== ======== Pack merges ======== ========
+//	The merge is planned over the value form of the packs (see signature.hpp),
+//	the resulting pack is then built in a single expansion of the plan.
+
+template<typename Entry, int8_t Rank>
+struct rerank;
+
+template<c_standard Standard, int8_t Rank, int8_t NewRank>
+struct rerank<dimension<Standard, Rank>, NewRank>
+{
+	using type = dimension<Standard, NewRank>;
+};
+
+template<c_mutiplier Scalar, int8_t Power, int8_t NewPower>
+struct rerank<scalar<Scalar, Power>, NewPower>
+{
+	using type = scalar<Scalar, NewPower>;
+};
+
+
+template<core::c_pack Pack1, core::c_pack Pack2, merge_step Step>
+struct merge_step_type
+{
+	using type = typename rerank<core::pack_get_t<Pack1, Step.index>, Step.rank>::type;
+};
+
+template<core::c_pack Pack1, core::c_pack Pack2, merge_step Step> requires (Step.source == merge_source::first)
+struct merge_step_type<Pack1, Pack2, Step>
+{
+	using type = core::pack_get_t<Pack1, Step.index>;
+};
+
+template<core::c_pack Pack1, core::c_pack Pack2, merge_step Step> requires (Step.source == merge_source::second)
+struct merge_step_type<Pack1, Pack2, Step>
+{
+	using type = core::pack_get_t<Pack2, Step.index>;
+};
+
+
+/// \brief Builds the pack described by a merge plan
+template<core::c_pack Pack1, core::c_pack Pack2, auto Plan>
+struct apply_merge_plan
+{
+private:
+	template<uintptr_t... Index>
+	static core::pack<typename merge_step_type<Pack1, Pack2, Plan[Index]>::type...> build(std::integer_sequence<uintptr_t, Index...>);
 
 public:
-	static constexpr bool value = check();
+	using type = decltype(build(std::make_integer_sequence<uintptr_t, Plan.size()>{}));
 };
 
 
@@ -198,74 +172,8 @@ public:
 template<core::c_pack Pack1, core::c_pack Pack2>
 struct dimension_merge_clober
 {
-private:
-	static constexpr uintptr_t pack1_size = core::pack_count_v<Pack1>;
-	static constexpr uintptr_t pack2_size = core::pack_count_v<Pack2>;
-
-	template<typename Acumulated = core::pack<>, uintptr_t Index1 = 0, uintptr_t Index2 = 0>
-	static constexpr auto merge()
-	{
-		if constexpr (Index1 < pack1_size)
-		{
-			if constexpr (Index2 < pack2_size)
-			{
-				using type1 = typename core::pack_get_t<Pack1, Index1>;
-				using type2 = typename core::pack_get_t<Pack2, Index2>;
-
-				if constexpr(
-					compare_equal_metric_v<typename type1::metric_t, typename type2::metric_t>
-					)
-				{
-					constexpr int8_t res_rank = type1::rank + type2::rank;
-					if constexpr(res_rank == 0)
-					{
-						return merge<Acumulated, Index1 + 1, Index2 + 1>();
-					}
-					else
-					{
-
-						return merge<
-							core::pack_cat_t<
-								Acumulated,
-								core::pack<dimension<typename type1::standard_t, res_rank>>>
-							, Index1 + 1, Index2 + 1>();
-					}
-				}
-				else
-				{
-					if constexpr(
-						compare_less_metric_v<typename type1::metric_t, typename type2::metric_t>
-						)
-					{
-						return merge<core::pack_cat_t<Acumulated, core::pack<type1>>, Index1 + 1, Index2>();
-					}
-					else
-					{
-						return merge<core::pack_cat_t<Acumulated, core::pack<type2>>, Index1, Index2 + 1>();
-					}
-				}
-			}
-			else
-			{
-				return direct_declval<core::pack_cat_t<Acumulated, core::sub_pack_t<Pack1, Index1>>>();
-			}
-		}
-		else
-		{
-			if constexpr(Index2 < pack2_size)
-			{
-				return direct_declval<core::pack_cat_t<Acumulated, core::sub_pack_t<Pack2, Index2>>>();
-			}
-			else
-			{
-				return direct_declval<Acumulated>();
-			}
-		}
-	}
-
-
-public:
-	using type = decltype(merge());
+	using type = typename apply_merge_plan<Pack1, Pack2,
+		dimension_merge_plan_v<false, paired_dimension_entries_v<Pack1, Pack2>, paired_dimension_entries_v<Pack2, Pack1>>>::type;
 };
 
 
@@ -274,75 +182,8 @@ public:
 template<core::c_pack Pack1, core::c_pack Pack2>
 struct dimension_merge_no_clober
 {
-private:
-	static constexpr uintptr_t pack1_size = core::pack_count_v<Pack1>;
-	static constexpr uintptr_t pack2_size = core::pack_count_v<Pack2>;
-
-	template<typename Acumulated = core::pack<>, uintptr_t Index1 = 0, uintptr_t Index2 = 0>
-	static constexpr auto merge()
-	{
-		if constexpr (Index1 < pack1_size)
-		{
-			if constexpr(Index2 < pack2_size)
-			{
-				using type1 = typename core::pack_get_t<Pack1, Index1>;
-				using type2 = typename core::pack_get_t<Pack2, Index2>;
-
-				if constexpr(
-					compare_equal_metric_v<typename type1::metric_t, typename type2::metric_t>
-					&& type1::base_gauge == type2::base_gauge)
-				{
-					constexpr int8_t res_rank = type1::rank + type2::rank;
-					if constexpr(res_rank == 0)
-					{
-						return merge<Acumulated, Index1 + 1, Index2 + 1>();
-					}
-					else
-					{
-						return merge<
-							core::pack_cat_t<
-								Acumulated,
-								core::pack<dimension<typename type1::standard_t, res_rank>>>
-							, Index1 + 1, Index2 + 1>();
-					}
-				}
-				else
-				{
-					if constexpr(
-						compare_equal_metric_v<typename type1::metric_t, typename type2::metric_t>
-						? type1::base_gauge < type2::base_gauge :
-						compare_less_metric_v<typename type1::metric_t, typename type2::metric_t>
-						)
-					{
-						return merge<core::pack_cat_t<Acumulated, core::pack<type1>>, Index1 + 1, Index2>();
-					}
-					else
-					{
-						return merge<core::pack_cat_t<Acumulated, core::pack<type2>>, Index1, Index2 + 1>();
-					}
-				}
-			}
-			else
-			{
-				return direct_declval<core::pack_cat_t<Acumulated, core::sub_pack_t<Pack1, Index1>>>();
-			}
-		}
-		else
-		{
-			if constexpr(Index2 < pack2_size)
-			{
-				return direct_declval<core::pack_cat_t<Acumulated, core::sub_pack_t<Pack2, Index2>>>();
-			}
-			else
-			{
-				return direct_declval<Acumulated>();
-			}
-		}
-	}
-
-
-public:
-	using type = decltype(merge());
+	using type = typename apply_merge_plan<Pack1, Pack2,
+		dimension_merge_plan_v<true, paired_dimension_entries_v<Pack1, Pack2>, paired_dimension_entries_v<Pack2, Pack1>>>::type;
 };
 
 
@@ -351,67 +192,8 @@ public:
 template<core::c_pack Pack1, core::c_pack Pack2>
 struct scalar_merge
 {
-	static constexpr uintptr_t pack1_size = core::pack_count_v<Pack1>;
-	static constexpr uintptr_t pack2_size = core::pack_count_v<Pack2>;
-
-	template<typename Acumulated = core::pack<>, uintptr_t Index1 = 0, uintptr_t Index2 = 0>
-	static constexpr auto merge()
-	{
-		if constexpr (Index1 < pack1_size)
-		{
-			if constexpr(Index2 < pack2_size)
-			{
-				using type1 = typename core::pack_get_t<Pack1, Index1>;
-				using type2 = typename core::pack_get_t<Pack2, Index2>;
-
-				if constexpr(type1::base_factor == type2::base_factor)
-				{
-					constexpr int8_t res_power = type1::power + type2::power;
-					if constexpr(res_power == 0)
-					{
-						return merge<Acumulated, Index1 + 1, Index2 + 1>();
-					}
-					else
-					{
-						return merge<
-							core::pack_cat_t<
-							Acumulated,
-							core::pack<scalar<typename type1::scalar_t, res_power>>>
-							, Index1 + 1, Index2 + 1>();
-					}
-				}
-				else
-				{
-					if constexpr(type1::base_factor < type2::base_factor)
-					{
-						return merge<core::pack_cat_t<Acumulated, core::pack<type1>>, Index1 + 1, Index2>();
-					}
-					else
-					{
-						return merge<core::pack_cat_t<Acumulated, core::pack<type2>>, Index1, Index2 + 1>();
-					}
-				}
-			}
-			else
-			{
-				return direct_declval<core::pack_cat_t<Acumulated, core::sub_pack_t<Pack1, Index1>>>();
-			}
-		}
-		else
-		{
-			if constexpr(Index2 < pack2_size)
-			{
-				return direct_declval<core::pack_cat_t<Acumulated, core::sub_pack_t<Pack2, Index2>>>();
-			}
-			else
-			{
-				return direct_declval<Acumulated>();
-			}
-		}
-	}
-
-public:
-	using type = decltype(merge());
+	using type = typename apply_merge_plan<Pack1, Pack2,
+		scalar_merge_plan_v<scalar_entries_v<Pack1>, scalar_entries_v<Pack2>>>::type;
 };
 
 
@@ -420,16 +202,23 @@ public:
 template<c_ValidFP value_t, c_unit_pack Pack1, c_unit_pack Pack2, c_ValidFP value_t2> requires c_compatible_unit_pack<Pack1, Pack2>
 inline constexpr value_t metric_conversion(value_t2 p_t2)
 {
-	using dim1	= typename inverse_pack<typename Pack1::dimension_pack>::type;
-	using scal1	= typename inverse_pack<typename Pack1::scalar_pack>::type;
-	using dim2	= typename Pack2::dimension_pack;
-	using scal2	= typename Pack2::scalar_pack;
+	if constexpr(conversion_kind_v<Pack1, Pack2> == conversion_kind::interchangeable)
+	{
+		return static_cast<value_t>(p_t2);
+	}
+	else
+	{
+		using dim1	= typename inverse_pack<typename Pack1::dimension_pack>::type;
+		using scal1	= typename inverse_pack<typename Pack1::scalar_pack>::type;
+		using dim2	= typename Pack2::dimension_pack;
+		using scal2	= typename Pack2::scalar_pack;
 
-	constexpr long double scalar_factor = pack_multiply<typename scalar_merge<scal2, scal1>::type, get_factor>::value;
-	constexpr long double conversion = pack_multiply<typename dimension_merge_no_clober<dim2, dim1>::type, get_factor>::value * scalar_factor;
+		constexpr long double scalar_factor = pack_multiply<typename scalar_merge<scal2, scal1>::type, get_factor>::value;
+		constexpr long double conversion = pack_multiply<typename dimension_merge_no_clober<dim2, dim1>::type, get_factor>::value * scalar_factor;
 
-//	constexpr long double conversion = Pack2::gauge / Pack1::gauge;
-	return static_cast<value_t>(p_t2 * conversion);
+//		constexpr long double conversion = Pack2::gauge / Pack1::gauge;
+		return static_cast<value_t>(p_t2 * conversion);
+	}
 }
 
 
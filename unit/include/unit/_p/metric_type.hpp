@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <string_view>
+#include <type_traits>
 
 namespace unit::_p
 {
@@ -22,11 +24,38 @@ namespace unit::_p
 	concept c_metric_t = is_metric_t<T>::value;
 
 
+	/// \brief FNV-1a hash of a metric name
+	consteval uint64_t metric_hash(std::u8string_view p_name)
+	{
+		uint64_t t_hash = 0xCBF29CE484222325;
+		for(const char8_t t_char : p_name)
+		{
+			t_hash ^= static_cast<uint8_t>(t_char);
+			t_hash *= 0x00000100000001B3;
+		}
+		return t_hash;
+	}
+
+	/// \brief Integer identifier of a metric, used for ordering and equality instead of the name
+	template<c_metric_t T>
+	inline constexpr uint64_t metric_id_v = metric_hash(T::metric_name);
+
+	/// \brief Names are only compared when 2 different metrics share an id
+	template<c_metric_t T1, c_metric_t T2>
+	consteval bool check_metric_id()
+	{
+		if constexpr(metric_id_v<T1> == metric_id_v<T2> && !std::is_same_v<T1, T2>)
+		{
+			static_assert(T1::metric_name == T2::metric_name, "Metric id collision, metrics with different names have the same id");
+		}
+		return true;
+	}
+
 	template<c_metric_t T1, c_metric_t T2>
-	inline constexpr bool compare_less_metric_v = (T1::metric_name < T2::metric_name);
+	inline constexpr bool compare_less_metric_v = check_metric_id<T1, T2>() && (metric_id_v<T1> < metric_id_v<T2>);
 
 	template<c_metric_t T1, c_metric_t T2>
-	inline constexpr bool compare_equal_metric_v = (T1::metric_name == T2::metric_name);
+	inline constexpr bool compare_equal_metric_v = check_metric_id<T1, T2>() && (metric_id_v<T1> == metric_id_v<T2>);
 
 	using default_fp = double;
 }
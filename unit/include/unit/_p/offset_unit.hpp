@@ -30,10 +30,6 @@
 namespace unit::_p
 {
 
-template<c_ValidFP Type, c_unit_pack Pack>
-class Unit;
-
-
 template<c_ValidFP Type, c_proxy_property Property>
 class Offset_Unit
 {
@@ -55,14 +51,7 @@ public:
 		: m_value{p_value}
 	{}
 
-	template<c_ValidFP Type2, c_unit_pack Pack2> requires
-		c_interchangeable_unit_pack<unit_pack_t, typename Unit<Type2, Pack2>::unit_pack>
-	inline constexpr Offset_Unit(const Unit<Type2, Pack2>& p_other)
-		: m_value{p_other.value() - offset()}
-	{}
-
-	template<c_ValidFP Type2, c_unit_pack Pack2> requires
-		c_weak_compatible_unit_pack<unit_pack_t, typename Unit<Type2, Pack2>::unit_pack>
+	template<c_ValidFP Type2, c_unit_pack Pack2> requires c_compatible_unit_pack<unit_pack_t, Pack2>
 	inline constexpr Offset_Unit(const Unit<Type2, Pack2>& p_other)
 		: m_value{metric_conversion<Type, unit_pack_t, Pack2>(p_other.value()) - offset()}
 	{}
@@ -97,34 +86,33 @@ public:
 		return *this;
 	}
 
-	template<c_ValidFP Type2, c_unit_pack Pack2> requires
-		c_interchangeable_unit_pack<unit_pack_t, typename Unit<Type2, Pack2>::unit_pack>
-	inline constexpr auto operator + (const Unit<Type2, Pack2>& p_other) const
-	{
-		using vtype = decltype(std::declval<Type>() + std::declval<Type2>());
-		return Offset_Unit<vtype, Property>{m_value + p_other.value()};
-	}
-
-	template<c_ValidFP Type2, c_unit_pack Pack2> requires
-		c_weak_compatible_unit_pack<unit_pack_t, typename Unit<Type2, Pack2>::unit_pack>
+	/// \note Adding a unit of the same gauge keeps the offset, any other gauge goes through the absolute unit
+	template<c_ValidFP Type2, c_unit_pack Pack2> requires c_compatible_unit_pack<unit_pack_t, Pack2>
 	inline constexpr auto operator + (const Unit<Type2, Pack2>& p_other) const
 	{
-		return to_unit() + p_other;
-	}
-
-	template<c_ValidFP Type2, c_unit_pack Pack2> requires
-		c_interchangeable_unit_pack<unit_pack_t, typename Unit<Type2, Pack2>::unit_pack>
-	inline constexpr auto operator - (const Unit<Type2, Pack2>& p_other) const
-	{
-		using vtype = decltype(std::declval<Type>() - std::declval<Type2>());
-		return Offset_Unit<vtype, Property>{m_value - p_other.value()};
+		if constexpr(conversion_kind_v<unit_pack_t, Pack2> == conversion_kind::interchangeable)
+		{
+			using vtype = decltype(std::declval<Type>() + std::declval<Type2>());
+			return Offset_Unit<vtype, Property>{m_value + p_other.value()};
+		}
+		else
+		{
+			return to_unit() + p_other;
+		}
 	}
 
-	template<c_ValidFP Type2, c_unit_pack Pack2> requires
-		c_weak_compatible_unit_pack<unit_pack_t, typename Unit<Type2, Pack2>::unit_pack>
+	template<c_ValidFP Type2, c_unit_pack Pack2> requires c_compatible_unit_pack<unit_pack_t, Pack2>
 	inline constexpr auto operator - (const Unit<Type2, Pack2>& p_other) const
 	{
-		return to_unit() - p_other;
+		if constexpr(conversion_kind_v<unit_pack_t, Pack2> == conversion_kind::interchangeable)
+		{
+			using vtype = decltype(std::declval<Type>() - std::declval<Type2>());
+			return Offset_Unit<vtype, Property>{m_value - p_other.value()};
+		}
+		else
+		{
+			return to_unit() - p_other;
+		}
 	}
 
 	inline constexpr Unit<value_t, unit_pack_t> operator - (const Offset_Unit& p_other) const
@@ -172,4 +160,5 @@ private:
 };
 
 
+
 } //namespace unit::_p
@@ -0,0 +1,368 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <CoreLib/core_pack.hpp>
+
+#include "metric_type.hpp"
+#include "dimension.hpp"
+
+namespace unit::_p
+{
+
+//======== ======== Signature entries ======== ========
+
+/// \brief Value form of dimension<Standard, Rank>, the standard is identified by its metric and gauge
+struct dimension_entry
+{
+	uint64_t	metric;
+	long double	gauge;
+	int8_t		rank;
+};
+
+/// \brief Value form of scalar<Scalar, Power>
+struct scalar_entry
+{
+	long double	factor;
+	int8_t		power;
+};
+
+/// \brief Entries produced by a merge, the size is only known after the merge is evaluated
+template<typename Entry, uintptr_t Capacity>
+struct entry_buffer
+{
+	std::array<Entry, Capacity> entries{};
+	uintptr_t size = 0;
+
+	constexpr void push(const Entry& p_entry)
+	{
+		entries[size++] = p_entry;
+	}
+};
+
+/// \brief Value form of a unit_pack, a single structural value usable as a template parameter
+template<uintptr_t DimensionCount, uintptr_t ScalarCount>
+struct unit_signature
+{
+	std::array<dimension_entry, DimensionCount>	dimensions;
+	std::array<scalar_entry, ScalarCount>		scalars;
+};
+
+
+template<typename... Dimensions>
+consteval std::array<dimension_entry, sizeof...(Dimensions)> make_dimension_entries(core::pack<Dimensions...>*)
+{
+	return {dimension_entry{metric_id_v<typename Dimensions::metric_t>, Dimensions::base_gauge, Dimensions::rank}...};
+}
+
+template<typename... Scalars>
+consteval std::array<scalar_entry, sizeof...(Scalars)> make_scalar_entries(core::pack<Scalars...>*)
+{
+	return {scalar_entry{Scalars::base_factor, Scalars::power}...};
+}
+
+template<core::c_pack Pack>
+inline constexpr auto dimension_entries_v = make_dimension_entries(static_cast<Pack*>(nullptr));
+
+template<core::c_pack Pack>
+inline constexpr auto scalar_entries_v = make_scalar_entries(static_cast<Pack*>(nullptr));
+
+/// \brief Checks the metric ids of every pair of dimensions across 2 packs, see check_metric_id
+template<typename Metric, typename... Dimensions>
+consteval bool check_metric_ids(core::pack<Dimensions...>*)
+{
+	return (check_metric_id<Metric, typename Dimensions::metric_t>() && ...);
+}
+
+template<typename... Dimensions1, core::c_pack Pack2>
+consteval bool check_metric_ids(core::pack<Dimensions1...>*, Pack2*)
+{
+	return (check_metric_ids<typename Dimensions1::metric_t>(static_cast<Pack2*>(nullptr)) && ...);
+}
+
+/// \brief Dimension entries of Pack, to be compared against those of Other
+/// \note Entries only carry the metric id, any operation that pairs the entries of 2 packs goes through here
+///	so that a collision of ids between different metrics is diagnosed instead of the metrics being merged.
+template<core::c_pack Pack, core::c_pack Other>
+inline constexpr auto paired_dimension_entries_v =
+	(check_metric_ids(static_cast<Pack*>(nullptr), static_cast<Other*>(nullptr)), dimension_entries_v<Pack>);
+
+template<core::c_pack Dimensions, core::c_pack Scalars>
+inline constexpr unit_signature<core::pack_count_v<Dimensions>, core::pack_count_v<Scalars>> unit_signature_v
+{
+	dimension_entries_v<Dimensions>,
+	scalar_entries_v<Scalars>
+};
+
+
+//======== ======== Signature operations ======== ========
+
+/// \brief Same order as less<dimension, dimension>
+constexpr bool dimension_less(const dimension_entry& p_1, const dimension_entry& p_2)
+{
+	return p_1.metric == p_2.metric ? p_1.gauge < p_2.gauge : p_1.metric < p_2.metric;
+}
+
+/// \brief Both sides have the same metrics with the same ranks
+template<uintptr_t Size1, uintptr_t Size2>
+constexpr bool compatible_dimensions(const std::array<dimension_entry, Size1>& p_1, const std::array<dimension_entry, Size2>& p_2)
+{
+	if constexpr(Size1 != Size2)
+	{
+		return false;
+	}
+	else
+	{
+		for(uintptr_t i = 0; i < Size1; ++i)
+		{
+			if(p_1[i].metric != p_2[i].metric || p_1[i].rank != p_2[i].rank)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+/// \brief A metric is measured with different standards on each side
+/// \warning Requires entries to be sorted
+template<uintptr_t Size1, uintptr_t Size2>
+constexpr bool conflicting_dimensions(const std::array<dimension_entry, Size1>& p_1, const std::array<dimension_entry, Size2>& p_2)
+{
+	uintptr_t i = 0;
+	uintptr_t j = 0;
+	while(i < Size1 && j < Size2)
+	{
+		if(p_1[i].metric == p_2[j].metric)
+		{
+			if(p_1[i].gauge != p_2[j].gauge)
+			{
+				return true;
+			}
+			++i;
+			++j;
+		}
+		else if(p_1[i].metric < p_2[j].metric)
+		{
+			++i;
+		}
+		else
+		{
+			++j;
+		}
+	}
+	return false;
+}
+
+template<uintptr_t Size>
+constexpr std::array<dimension_entry, Size> invert_dimensions(std::array<dimension_entry, Size> p_entries)
+{
+	for(dimension_entry& t_entry : p_entries)
+	{
+		t_entry.rank = static_cast<int8_t>(-t_entry.rank);
+	}
+	return p_entries;
+}
+
+template<uintptr_t Size>
+constexpr std::array<scalar_entry, Size> invert_scalars(std::array<scalar_entry, Size> p_entries)
+{
+	for(scalar_entry& t_entry : p_entries)
+	{
+		t_entry.power = static_cast<int8_t>(-t_entry.power);
+	}
+	return p_entries;
+}
+
+//======== ======== Merge plans ======== ========
+
+enum class merge_source: uint8_t
+{
+	first,		//!< entry taken as is from the first list
+	second,		//!< entry taken as is from the second list
+	combined,	//!< entry of the first list with the ranks (or powers) of both added
+};
+
+/// \brief Describes where an element of a merged list comes from, so that the merged type pack can be built in a single step
+struct merge_step
+{
+	merge_source	source;
+	uintptr_t		index;
+	int8_t			rank;
+};
+
+/// \brief Plans the merge of 2 sorted dimension lists, adding the ranks of matching entries and dropping those that cancel out
+/// \tparam ByStandard - if false entries match by metric alone (assumes no conflicting units), otherwise metric and gauge must match
+/// \warning Requires entries to be sorted
+template<bool ByStandard, uintptr_t Size1, uintptr_t Size2>
+constexpr entry_buffer<merge_step, Size1 + Size2> dimension_merge_plan(const std::array<dimension_entry, Size1>& p_1, const std::array<dimension_entry, Size2>& p_2)
+{
+	entry_buffer<merge_step, Size1 + Size2> t_result;
+	uintptr_t i = 0;
+	uintptr_t j = 0;
+	while(i < Size1 && j < Size2)
+	{
+		if(p_1[i].metric == p_2[j].metric && (!ByStandard || p_1[i].gauge == p_2[j].gauge))
+		{
+			const int8_t t_rank = static_cast<int8_t>(p_1[i].rank + p_2[j].rank);
+			if(t_rank != 0)
+			{
+				t_result.push(merge_step{merge_source::combined, i, t_rank});
+			}
+			++i;
+			++j;
+		}
+		else if(ByStandard ? dimension_less(p_1[i], p_2[j]) : p_1[i].metric < p_2[j].metric)
+		{
+			t_result.push(merge_step{merge_source::first, i, p_1[i].rank});
+			++i;
+		}
+		else
+		{
+			t_result.push(merge_step{merge_source::second, j, p_2[j].rank});
+			++j;
+		}
+	}
+	for(; i < Size1; ++i) t_result.push(merge_step{merge_source::first, i, p_1[i].rank});
+	for(; j < Size2; ++j) t_result.push(merge_step{merge_source::second, j, p_2[j].rank});
+	return t_result;
+}
+
+/// \brief Plans the merge of 2 sorted scalar lists, adding the powers of matching factors and dropping those that cancel out
+/// \warning Requires entries to be sorted
+template<uintptr_t Size1, uintptr_t Size2>
+constexpr entry_buffer<merge_step, Size1 + Size2> scalar_merge_plan(const std::array<scalar_entry, Size1>& p_1, const std::array<scalar_entry, Size2>& p_2)
+{
+	entry_buffer<merge_step, Size1 + Size2> t_result;
+	uintptr_t i = 0;
+	uintptr_t j = 0;
+	while(i < Size1 && j < Size2)
+	{
+		if(p_1[i].factor == p_2[j].factor)
+		{
+			const int8_t t_power = static_cast<int8_t>(p_1[i].power + p_2[j].power);
+			if(t_power != 0)
+			{
+				t_result.push(merge_step{merge_source::combined, i, t_power});
+			}
+			++i;
+			++j;
+		}
+		else if(p_1[i].factor < p_2[j].factor)
+		{
+			t_result.push(merge_step{merge_source::first, i, p_1[i].power});
+			++i;
+		}
+		else
+		{
+			t_result.push(merge_step{merge_source::second, j, p_2[j].power});
+			++j;
+		}
+	}
+	for(; i < Size1; ++i) t_result.push(merge_step{merge_source::first, i, p_1[i].power});
+	for(; j < Size2; ++j) t_result.push(merge_step{merge_source::second, j, p_2[j].power});
+	return t_result;
+}
+
+/// \brief Merges 2 sorted dimension lists, see dimension_merge_plan
+template<bool ByStandard, uintptr_t Size1, uintptr_t Size2>
+constexpr entry_buffer<dimension_entry, Size1 + Size2> merge_dimensions(const std::array<dimension_entry, Size1>& p_1, const std::array<dimension_entry, Size2>& p_2)
+{
+	const entry_buffer<merge_step, Size1 + Size2> t_plan = dimension_merge_plan<ByStandard>(p_1, p_2);
+
+	entry_buffer<dimension_entry, Size1 + Size2> t_result;
+	for(uintptr_t i = 0; i < t_plan.size; ++i)
+	{
+		const merge_step& t_step = t_plan.entries[i];
+		dimension_entry t_entry = t_step.source == merge_source::second ? p_2[t_step.index] : p_1[t_step.index];
+		t_entry.rank = t_step.rank;
+		t_result.push(t_entry);
+	}
+	return t_result;
+}
+
+/// \brief Merges 2 sorted scalar lists, see scalar_merge_plan
+template<uintptr_t Size1, uintptr_t Size2>
+constexpr entry_buffer<scalar_entry, Size1 + Size2> merge_scalars(const std::array<scalar_entry, Size1>& p_1, const std::array<scalar_entry, Size2>& p_2)
+{
+	const entry_buffer<merge_step, Size1 + Size2> t_plan = scalar_merge_plan(p_1, p_2);
+
+	entry_buffer<scalar_entry, Size1 + Size2> t_result;
+	for(uintptr_t i = 0; i < t_plan.size; ++i)
+	{
+		const merge_step& t_step = t_plan.entries[i];
+		scalar_entry t_entry = t_step.source == merge_source::second ? p_2[t_step.index] : p_1[t_step.index];
+		t_entry.power = t_step.rank;
+		t_result.push(t_entry);
+	}
+	return t_result;
+}
+
+/// \brief Trims a merge result to its final size
+template<auto Buffer>
+consteval auto shrink_entries()
+{
+	std::array<std::remove_cvref_t<decltype(Buffer.entries[0])>, Buffer.size> t_result{};
+	for(uintptr_t i = 0; i < Buffer.size; ++i)
+	{
+		t_result[i] = Buffer.entries[i];
+	}
+	return t_result;
+}
+
+
+//======== ======== Cached results ======== ========
+//	Entries are passed by value, so every distinct pair is evaluated only once per translation unit
+
+template<auto Dimensions1, auto Dimensions2>
+inline constexpr bool compatible_dimensions_v = compatible_dimensions(Dimensions1, Dimensions2);
+
+template<auto Dimensions1, auto Dimensions2>
+inline constexpr bool conflicting_dimensions_v = conflicting_dimensions(Dimensions1, Dimensions2);
+
+template<bool ByStandard, auto Dimensions1, auto Dimensions2>
+inline constexpr auto merge_dimensions_v = shrink_entries<merge_dimensions<ByStandard>(Dimensions1, Dimensions2)>();
+
+template<auto Scalars1, auto Scalars2>
+inline constexpr auto merge_scalars_v = shrink_entries<merge_scalars(Scalars1, Scalars2)>();
+
+template<bool ByStandard, auto Dimensions1, auto Dimensions2>
+inline constexpr auto dimension_merge_plan_v = shrink_entries<dimension_merge_plan<ByStandard>(Dimensions1, Dimensions2)>();
+
+template<auto Scalars1, auto Scalars2>
+inline constexpr auto scalar_merge_plan_v = shrink_entries<scalar_merge_plan(Scalars1, Scalars2)>();
+
+template<unit_signature Signature>
+inline constexpr auto invert_signature_v = unit_signature<Signature.dimensions.size(), Signature.scalars.size()>
+{
+	invert_dimensions(Signature.dimensions),
+	invert_scalars(Signature.scalars)
+};
+
+} //namespace unit::_p
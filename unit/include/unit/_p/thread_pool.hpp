@@ -0,0 +1,275 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "utils.hpp"
+
+namespace unit::_p
+{
+
+/// \brief Pool of persistent worker threads, every job is executed once by each worker
+/// \note The thread calling run() participates as worker 0.
+///		A run() issued from inside a job of the same pool is executed serially by the calling thread,
+///		a run() on a different pool is dispatched normally. Pools must not be nested in a cycle.
+///		Jobs must not throw.
+class thread_pool
+{
+public:
+	/// \param[in] p_thread_count - total number of workers, including the calling thread
+	inline explicit thread_pool(uintptr_t p_thread_count = std::thread::hardware_concurrency())
+	{
+		if(p_thread_count == 0) p_thread_count = 1;
+
+		m_threads.reserve(p_thread_count - 1);
+		for(uintptr_t i = 1; i < p_thread_count; ++i)
+		{
+			m_threads.emplace_back(&thread_pool::worker_loop, this, i);
+		}
+	}
+
+	inline ~thread_pool()
+	{
+		{
+			std::lock_guard t_lock{m_mutex};
+			m_stop = true;
+		}
+		m_wake.notify_all();
+		for(std::thread& t_thread: m_threads)
+		{
+			t_thread.join();
+		}
+	}
+
+	thread_pool(const thread_pool&) = delete;
+	thread_pool& operator = (const thread_pool&) = delete;
+
+	inline uintptr_t size() const { return m_threads.size() + 1; }
+
+	/// \brief Executes p_task(worker_index) once for every worker, and waits for all of them to finish
+	template<typename Task>
+	void run(Task& p_task)
+	{
+		if(m_threads.empty() || current_pool() == this)
+		{
+			for(uintptr_t i = 0; i < size(); ++i)
+			{
+				p_task(i);
+			}
+			return;
+		}
+
+		std::lock_guard t_run_lock{m_run_mutex};
+		{
+			std::lock_guard t_lock{m_mutex};
+			m_task		= &p_task;
+			m_invoke	= [](void* p_context, uintptr_t p_index) { (*static_cast<Task*>(p_context))(p_index); };
+			m_pending	= m_threads.size();
+			++m_generation;
+		}
+		m_wake.notify_all();
+
+		const thread_pool* const t_outer = current_pool();
+		current_pool() = this;
+		p_task(0);
+		current_pool() = t_outer;
+
+		std::unique_lock t_lock{m_mutex};
+		m_done.wait(t_lock, [this] { return m_pending == 0; });
+		m_task = nullptr;
+	}
+
+private:
+	/// \brief Pool whose job is being executed by this thread, if any
+	static inline const thread_pool*& current_pool()
+	{
+		static thread_local const thread_pool* g_pool = nullptr;
+		return g_pool;
+	}
+
+	inline void worker_loop(uintptr_t p_index)
+	{
+		current_pool() = this;
+
+		uint64_t t_generation = 0;
+		std::unique_lock t_lock{m_mutex};
+		while(true)
+		{
+			m_wake.wait(t_lock, [&] { return m_stop || m_generation != t_generation; });
+			if(m_stop) return;
+
+			t_generation = m_generation;
+			void* const t_task = m_task;
+			void (* const t_invoke)(void*, uintptr_t) = m_invoke;
+
+			t_lock.unlock();
+			t_invoke(t_task, p_index);
+			t_lock.lock();
+
+			if(--m_pending == 0)
+			{
+				m_done.notify_one();
+			}
+		}
+	}
+
+private:
+	std::vector<std::thread>	m_threads;
+	std::mutex					m_run_mutex;
+	std::mutex					m_mutex;
+	std::condition_variable		m_wake;
+	std::condition_variable		m_done;
+	void*						m_task		= nullptr;
+	void (*m_invoke)(void*, uintptr_t)		= nullptr;
+	uint64_t					m_generation	= 0;
+	uintptr_t					m_pending		= 0;
+	bool						m_stop			= false;
+};
+
+
+/// \brief Process wide pool, sized to the hardware concurrency
+inline thread_pool& default_thread_pool()
+{
+	static thread_pool g_pool;
+	return g_pool;
+}
+
+
+//======== ======== Work stealing ======== ========
+
+/// \brief Contiguous range of chunk indexes owned by a worker
+/// \note Both ends are packed in a single atomic word, the owner consumes from the front and thieves take the back half.
+struct alignas(cache_line_size) chunk_range
+{
+	static constexpr uintptr_t max_chunks = 0xFFFFFFFF;
+
+	inline void assign(uint64_t p_begin, uint64_t p_end)
+	{
+		m_packed.store((p_begin << 32) | p_end, std::memory_order_release);
+	}
+
+	inline bool pop_front(uintptr_t& p_chunk)
+	{
+		uint64_t t_current = m_packed.load(std::memory_order_acquire);
+		while(true)
+		{
+			const uint64_t t_begin	= t_current >> 32;
+			const uint64_t t_end	= t_current & 0xFFFFFFFF;
+			if(t_begin >= t_end) return false;
+
+			if(m_packed.compare_exchange_weak(t_current, ((t_begin + 1) << 32) | t_end, std::memory_order_acq_rel, std::memory_order_acquire))
+			{
+				p_chunk = static_cast<uintptr_t>(t_begin);
+				return true;
+			}
+		}
+	}
+
+	inline bool steal_back(uint64_t& p_begin, uint64_t& p_end)
+	{
+		uint64_t t_current = m_packed.load(std::memory_order_acquire);
+		while(true)
+		{
+			const uint64_t t_begin	= t_current >> 32;
+			const uint64_t t_end	= t_current & 0xFFFFFFFF;
+			if(t_begin >= t_end) return false;
+
+			const uint64_t t_middle = t_begin + (t_end - t_begin) / 2;
+			if(m_packed.compare_exchange_weak(t_current, (t_begin << 32) | t_middle, std::memory_order_acq_rel, std::memory_order_acquire))
+			{
+				p_begin	= t_middle;
+				p_end	= t_end;
+				return true;
+			}
+		}
+	}
+
+	std::atomic<uint64_t> m_packed{0};
+};
+
+
+/// \brief Calls p_body(chunk_index) for every chunk in [0, p_chunk_count) using the workers of p_pool
+/// \note Every worker starts with an even contiguous share of the chunks, so repeated passes over the same data
+///		touch the same memory from the same worker (friendly to first-touch NUMA placement).
+///		Workers that run dry steal half of the remaining chunks of another worker.
+template<typename Body>
+void for_each_chunk(thread_pool& p_pool, uintptr_t p_chunk_count, Body& p_body)
+{
+	const uintptr_t t_workers = p_pool.size();
+	if(t_workers < 2 || p_chunk_count < 2)
+	{
+		for(uintptr_t i = 0; i < p_chunk_count; ++i)
+		{
+			p_body(i);
+		}
+		return;
+	}
+
+	std::vector<chunk_range> t_ranges(t_workers);
+	for(uintptr_t i = 0; i < t_workers; ++i)
+	{
+		t_ranges[i].assign(
+			static_cast<uint64_t>(p_chunk_count) * i / t_workers,
+			static_cast<uint64_t>(p_chunk_count) * (i + 1) / t_workers);
+	}
+
+	auto t_task = [&](uintptr_t p_worker)
+	{
+		chunk_range& t_own = t_ranges[p_worker];
+		while(true)
+		{
+			uintptr_t t_chunk;
+			while(t_own.pop_front(t_chunk))
+			{
+				p_body(t_chunk);
+			}
+
+			bool t_stolen = false;
+			for(uintptr_t i = 1; i < t_workers; ++i)
+			{
+				uint64_t t_begin;
+				uint64_t t_end;
+				if(t_ranges[(p_worker + i) % t_workers].steal_back(t_begin, t_end))
+				{
+					t_own.assign(t_begin, t_end);
+					t_stolen = true;
+					break;
+				}
+			}
+			if(!t_stolen) return;
+		}
+	};
+
+	p_pool.run(t_task);
+}
+
+} //namespace unit::_p
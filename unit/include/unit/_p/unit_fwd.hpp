@@ -0,0 +1,101 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <type_traits>
+
+#include <CoreLib/core_pack.hpp>
+
+#include "utils.hpp"
+#include "metric_type.hpp"
+#include "dimension.hpp"
+
+namespace unit::_p
+{
+
+/// \brief stores information about the unit, defined in metric_pack.hpp
+template<core::c_pack Dimensions, core::c_pack Scalars>
+struct unit_pack;
+
+template<typename> struct is_unit_pack : public std::false_type {};
+template<typename ...Type> struct is_unit_pack<unit_pack<Type...>> : public std::true_type{};
+
+template<typename T>
+constexpr bool is_unit_pack_v = is_unit_pack<T>::value;
+
+template<typename T>
+concept c_unit_pack = is_unit_pack_v<T>;
+
+
+/// \brief defined in unit_type.hpp
+template<c_ValidFP Type, c_unit_pack Pack>
+class Unit;
+
+/// \brief defined in offset_unit.hpp
+template<c_ValidFP Type, c_proxy_property Property>
+class Offset_Unit;
+
+
+template<typename> struct is_unit : public std::false_type {};
+template<c_ValidFP Type, c_unit_pack Pack> struct is_unit<Unit<Type, Pack>> : public std::true_type{};
+
+template<typename T>
+constexpr bool is_unit_v = is_unit<T>::value;
+
+template<typename T>
+concept c_unit = is_unit_v<T>;
+
+
+template<typename> struct is_offset_unit : public std::false_type {};
+template<c_ValidFP Type, c_proxy_property Property> struct is_offset_unit<Offset_Unit<Type, Property>> : public std::true_type{};
+
+template<typename T>
+constexpr bool is_offset_unit_v = is_offset_unit<T>::value;
+
+template<typename T>
+concept c_offset_unit = is_offset_unit_v<T>;
+
+}	//namespace unit::_p
+
+
+namespace unit
+{
+
+template<_p::c_ValidFP Type, core::c_pack Dimensions, core::c_pack Scalars>
+struct make_unit
+{
+private:
+	static_assert(!core::pack_contains_v<Dimensions, _p::not_dimension>, "Dimension pack can only contain dimensions");
+	static_assert(!core::pack_contains_v<Scalars, _p::not_scalar>, "Scalar pack can only contain scalars");
+
+	using sorted_dim	= typename _p::pack_sort<Dimensions, _p::less>::type;
+	using sorted_scal	= typename _p::pack_sort<Scalars, _p::less>::type;
+
+public:
+	using type = _p::Unit<Type, _p::unit_pack<sorted_dim, sorted_scal>>;
+};
+
+} //namespace unit
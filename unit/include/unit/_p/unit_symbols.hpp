@@ -0,0 +1,356 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+#include <CoreLib/core_pack.hpp>
+
+#include "../unit.hpp"
+#include "../unit_descriptor.hpp"
+#include "../standard/si_prefix.hpp"
+#include "../standard/digital_prefix.hpp"
+
+namespace unit::_p
+{
+
+/// \brief String usable as a template argument
+template<uintptr_t Size>
+struct fixed_string
+{
+	char m_text[Size];
+
+	consteval fixed_string(const char (&p_text)[Size])
+	{
+		std::copy_n(p_text, Size, m_text);
+	}
+
+	constexpr std::string_view view() const { return std::string_view{m_text, Size - 1}; }
+};
+
+
+//======== ======== Symbol definitions ======== ========
+
+/// \brief Which prefixes a symbol accepts
+enum class prefix_kind: uint8_t
+{
+	none	= 0,
+	decimal	= 1,	//!< SI prefixes, k, M, m, µ, ...
+	binary	= 2,	//!< IEC prefixes, Ki, Mi, Gi, ...
+	any		= decimal | binary,
+};
+
+inline constexpr bool accepts_prefix(prefix_kind p_symbol, prefix_kind p_prefix)
+{
+	return (static_cast<uint8_t>(p_symbol) & static_cast<uint8_t>(p_prefix)) != 0;
+}
+
+/// \brief Binds a unit symbol to the alias that represents it
+template<fixed_string Symbol, template<typename> typename Alias, prefix_kind Prefixes = prefix_kind::none>
+struct symbol_def
+{
+	static constexpr std::string_view symbol = Symbol.view();
+	static constexpr prefix_kind prefixes = Prefixes;
+
+	template<typename T>
+	using type = Alias<T>;
+};
+
+/// \brief Binds a prefix symbol to its multiplier
+template<fixed_string Symbol, template<int8_t> typename Scalar, prefix_kind Kind>
+struct prefix_def
+{
+	static constexpr std::string_view symbol = Symbol.view();
+	static constexpr prefix_kind kind = Kind;
+	static constexpr long double factor = Scalar<1>::factor;
+
+	template<int8_t Rank>
+	using type = Scalar<Rank>;
+};
+
+/// \brief Symbols of the standards in standard/*.hpp, and of common derived units
+/// \note doublet, quadlet and octlet are deliberately left out, they have no established symbol.
+///	Those units are written in bits, see unit_symbol in unit_format.hpp.
+using unit_symbol_pack = core::pack<
+	//lenght
+	symbol_def<"m",		metre_t,			prefix_kind::decimal>,
+	symbol_def<"ft",	foot_t>,
+	symbol_def<"in",	inch_t>,
+	symbol_def<"yd",	yard_t>,
+	symbol_def<"mi",	mile_t>,
+	symbol_def<"nmi",	nautical_mile_t>,
+	symbol_def<"ls",	light_second_t>,
+	symbol_def<"ly",	light_year_t>,
+	//area and volume
+	symbol_def<"ha",	hectare_t>,
+	symbol_def<"ac",	acre_t>,
+	symbol_def<"L",		litre_t,			prefix_kind::decimal>,
+	symbol_def<"l",		litre_t,			prefix_kind::decimal>,
+	//mass
+	symbol_def<"g",		gram_t,				prefix_kind::decimal>,
+	symbol_def<"kg",	kilogram_t>,
+	symbol_def<"t",		tonne_t,			prefix_kind::decimal>,
+	symbol_def<"lb",	pound_av_t>,
+	symbol_def<"oz",	ounce_av_t>,
+	//time
+	symbol_def<"s",		second_t,			prefix_kind::decimal>,
+	symbol_def<"min",	minute_t>,
+	symbol_def<"h",		hour_t>,
+	symbol_def<"Hz",	hertz_t,			prefix_kind::decimal>,
+	symbol_def<"rpm",	rotations_per_minute_t>,
+	//angle
+	symbol_def<"rad",	radian_t,			prefix_kind::decimal>,
+	symbol_def<"gon",	grad_t>,
+	symbol_def<"deg",	degree_t>,
+	symbol_def<"arcmin",arc_minute_t>,
+	symbol_def<"arcsec",arc_second_t>,
+	symbol_def<"tr",	turn_t>,
+	//velocity
+	symbol_def<"kn",	knot_t>,
+	symbol_def<"mph",	mile_per_hour_t>,
+	//electrical
+	symbol_def<"C",		coloumb_t,			prefix_kind::decimal>,
+	symbol_def<"Ah",	amper_hour_t,		prefix_kind::decimal>,
+	symbol_def<"A",		ampere_t,			prefix_kind::decimal>,
+	symbol_def<"V",		volt_t,				prefix_kind::decimal>,
+	symbol_def<"Ohm",	ohm_t,				prefix_kind::decimal>,
+	//luminosity
+	symbol_def<"cd",	candela_t,			prefix_kind::decimal>,
+	//digital
+	symbol_def<"bit",	bit_t,				prefix_kind::any>,
+	symbol_def<"B",		byte_t,				prefix_kind::any>,
+	//temperature
+	symbol_def<"K",		kelvin_t,			prefix_kind::decimal>,
+	symbol_def<"degR",	rankine_t>,
+	symbol_def<"degC",	celcius_t>,
+	symbol_def<"degF",	fahrenheit_t>,
+	//force, energy, power, pressure
+	symbol_def<"N",		newton_t,			prefix_kind::decimal>,
+	symbol_def<"kgf",	kilogram_force_t>,
+	symbol_def<"lbf",	pound_av_force_t>,
+	symbol_def<"J",		joule_t,			prefix_kind::decimal>,
+	symbol_def<"Wh",	watt_hour_t,		prefix_kind::decimal>,
+	symbol_def<"W",		watt_t,				prefix_kind::decimal>,
+	symbol_def<"Pa",	pascal_t,			prefix_kind::decimal>,
+	symbol_def<"bar",	bar_t,				prefix_kind::decimal>,
+	symbol_def<"atm",	atmosphere_t>,
+	symbol_def<"psi",	pound_av_force_per_square_inch_t>
+>;
+
+using unit_prefix_pack = core::pack<
+	prefix_def<"Y",		multi::yotta,	prefix_kind::decimal>,
+	prefix_def<"Z",		multi::zetta,	prefix_kind::decimal>,
+	prefix_def<"E",		multi::exa,		prefix_kind::decimal>,
+	prefix_def<"P",		multi::peta,	prefix_kind::decimal>,
+	prefix_def<"T",		multi::tera,	prefix_kind::decimal>,
+	prefix_def<"G",		multi::giga,	prefix_kind::decimal>,
+	prefix_def<"M",		multi::mega,	prefix_kind::decimal>,
+	prefix_def<"k",		multi::kilo,	prefix_kind::decimal>,
+	prefix_def<"h",		multi::hecto,	prefix_kind::decimal>,
+	prefix_def<"da",	multi::deca,	prefix_kind::decimal>,
+	prefix_def<"d",		multi::deci,	prefix_kind::decimal>,
+	prefix_def<"c",		multi::centi,	prefix_kind::decimal>,
+	prefix_def<"m",		multi::milli,	prefix_kind::decimal>,
+	prefix_def<"u",		multi::micro,	prefix_kind::decimal>,
+	prefix_def<"\xC2\xB5",		multi::micro,	prefix_kind::decimal>,
+	prefix_def<"n",		multi::nano,	prefix_kind::decimal>,
+	prefix_def<"p",		multi::pico,	prefix_kind::decimal>,
+	prefix_def<"f",		multi::femto,	prefix_kind::decimal>,
+	prefix_def<"a",		multi::atto,	prefix_kind::decimal>,
+	prefix_def<"z",		multi::zepto,	prefix_kind::decimal>,
+	prefix_def<"y",		multi::yocto,	prefix_kind::decimal>,
+	prefix_def<"Ki",	multi::kibi,	prefix_kind::binary>,
+	prefix_def<"Mi",	multi::mebi,	prefix_kind::binary>,
+	prefix_def<"Gi",	multi::gibi,	prefix_kind::binary>,
+	prefix_def<"Ti",	multi::tebi,	prefix_kind::binary>,
+	prefix_def<"Pi",	multi::pebi,	prefix_kind::binary>,
+	prefix_def<"Ei",	multi::exbi,	prefix_kind::binary>,
+	prefix_def<"Zi",	multi::zebi,	prefix_kind::binary>,
+	prefix_def<"Yi",	multi::yobi,	prefix_kind::binary>
+>;
+
+
+//======== ======== Runtime tables ======== ========
+
+struct symbol_entry
+{
+	std::string_view	symbol;
+	unit_descriptor		descriptor;
+	prefix_kind			prefixes;
+};
+
+struct prefix_entry
+{
+	std::string_view	symbol;
+	double				factor;
+	prefix_kind			kind;
+};
+
+template<typename... Defs>
+consteval std::array<symbol_entry, sizeof...(Defs)> make_symbol_entries(core::pack<Defs...>*)
+{
+	return {symbol_entry{Defs::symbol, unit_descriptor_v<typename Defs::template type<double>>, Defs::prefixes}...};
+}
+
+template<typename... Defs>
+consteval std::array<prefix_entry, sizeof...(Defs)> make_prefix_entries(core::pack<Defs...>*)
+{
+	return {prefix_entry{Defs::symbol, static_cast<double>(Defs::factor), Defs::kind}...};
+}
+
+inline constexpr std::array symbol_entries = make_symbol_entries(static_cast<unit_symbol_pack*>(nullptr));
+inline constexpr std::array prefix_entries = make_prefix_entries(static_cast<unit_prefix_pack*>(nullptr));
+
+inline constexpr uintptr_t max_prefix_size = 2;
+
+
+//======== ======== Perfect hash ======== ========
+
+/// \brief Index used when a symbol is not found
+inline constexpr uint8_t no_symbol = 0xFF;
+
+inline constexpr uint64_t symbol_hash(std::string_view p_text, uint64_t p_seed)
+{
+	uint64_t t_hash = 0xCBF29CE484222325 ^ (p_seed * 0x9E3779B97F4A7C15);
+	for(const char t_char : p_text)
+	{
+		t_hash ^= static_cast<uint8_t>(t_char);
+		t_hash *= 0x00000100000001B3;
+	}
+	return t_hash ^ (t_hash >> 32);
+}
+
+/// \brief Maps each symbol to a distinct slot, a lookup costs one hash and one string comparison
+struct symbol_index
+{
+	static constexpr uintptr_t slot_count = 512;
+	/// \brief Number of seeds tried before giving up, see make_symbol_index
+	static constexpr uint64_t max_seed = 4096;
+	/// \brief Seed of an index for which the search failed
+	static constexpr uint64_t no_seed = ~uint64_t{0};
+
+	uint64_t seed;
+	std::array<uint8_t, slot_count> slots;
+
+	inline constexpr uint8_t slot(std::string_view p_text) const
+	{
+		return slots[symbol_hash(p_text, seed) & (slot_count - 1)];
+	}
+};
+
+/// \brief Searches for a seed for which no 2 symbols share a slot
+/// \return An index with symbol_index::no_seed if none was found within symbol_index::max_seed tries
+template<typename Entry, uintptr_t Size>
+consteval symbol_index make_symbol_index(const std::array<Entry, Size>& p_entries)
+{
+	static_assert(Size < no_symbol, "Too many symbols for the index");
+
+	symbol_index t_index{};
+	for(uint64_t t_seed = 0; t_seed < symbol_index::max_seed; ++t_seed)
+	{
+		t_index.seed = t_seed;
+		t_index.slots.fill(no_symbol);
+
+		bool t_perfect = true;
+		for(uintptr_t i = 0; i < Size; ++i)
+		{
+			uint8_t& t_slot = t_index.slots[symbol_hash(p_entries[i].symbol, t_seed) & (symbol_index::slot_count - 1)];
+			if(t_slot != no_symbol)
+			{
+				t_perfect = false;
+				break;
+			}
+			t_slot = static_cast<uint8_t>(i);
+		}
+
+		if(t_perfect)
+		{
+			return t_index;
+		}
+	}
+
+	t_index.seed = symbol_index::no_seed;
+	return t_index;
+}
+
+inline constexpr symbol_index symbol_entries_index = make_symbol_index(symbol_entries);
+inline constexpr symbol_index prefix_entries_index = make_symbol_index(prefix_entries);
+
+static_assert(symbol_entries_index.seed != symbol_index::no_seed, "No collision-free seed for the unit symbols, increase slot_count");
+static_assert(prefix_entries_index.seed != symbol_index::no_seed, "No collision-free seed for the prefixes, increase slot_count");
+
+/// \return index in symbol_entries, or no_symbol
+inline constexpr uint8_t find_symbol(std::string_view p_text)
+{
+	const uint8_t t_index = symbol_entries_index.slot(p_text);
+	return (t_index != no_symbol && symbol_entries[t_index].symbol == p_text) ? t_index : no_symbol;
+}
+
+/// \return index in prefix_entries, or no_symbol
+inline constexpr uint8_t find_prefix(std::string_view p_text)
+{
+	const uint8_t t_index = prefix_entries_index.slot(p_text);
+	return (t_index != no_symbol && prefix_entries[t_index].symbol == p_text) ? t_index : no_symbol;
+}
+
+
+//======== ======== Symbol resolution ======== ========
+
+struct resolved_symbol
+{
+	uint8_t symbol = no_symbol;
+	uint8_t prefix = no_symbol;
+};
+
+/// \brief Resolves a symbol that may have a prefix, ex. "km" or "MiB"
+/// \note Whole symbols take precedence, so that "min" is a minute and "cd" is a candela
+inline constexpr resolved_symbol resolve_symbol(std::string_view p_text)
+{
+	if(const uint8_t t_symbol = find_symbol(p_text); t_symbol != no_symbol)
+	{
+		return resolved_symbol{t_symbol, no_symbol};
+	}
+
+	for(uintptr_t t_size = 1; t_size <= max_prefix_size && t_size < p_text.size(); ++t_size)
+	{
+		const uint8_t t_prefix = find_prefix(p_text.substr(0, t_size));
+		if(t_prefix == no_symbol)
+		{
+			continue;
+		}
+		const uint8_t t_symbol = find_symbol(p_text.substr(t_size));
+		if(t_symbol != no_symbol && accepts_prefix(symbol_entries[t_symbol].prefixes, prefix_entries[t_prefix].kind))
+		{
+			return resolved_symbol{t_symbol, t_prefix};
+		}
+	}
+	return resolved_symbol{};
+}
+
+} //namespace unit::_p
@@ -28,15 +28,12 @@
 #include "metric_type.hpp"
 #include "dimension.hpp"
 #include "utils.hpp"
+#include "unit_fwd.hpp"
 #include "metric_pack.hpp"
 
 namespace unit::_p
 {
 
-template<c_ValidFP Type, c_proxy_property Property>
-class Offset_Unit;
-
-
 template<c_ValidFP Type, c_unit_pack Pack>
 class Unit
 {
@@ -52,20 +49,13 @@ public:
 		: m_value{p_value}
 	{}
 
-	template<c_ValidFP Type2, c_unit_pack Pack2> requires
-		c_interchangeable_unit_pack<unit_pack, typename Unit<Type2, Pack2>::unit_pack>
-	inline constexpr Unit(const Unit<Type2, Pack2>& p_other)
-		: m_value{static_cast<value_t>(p_other.value())}
-	{}
-
-	template<c_ValidFP Type2, c_unit_pack Pack2> requires
-		c_weak_compatible_unit_pack<unit_pack, typename Unit<Type2, Pack2>::unit_pack>
+	template<c_ValidFP Type2, c_unit_pack Pack2> requires c_compatible_unit_pack<unit_pack, Pack2>
 	inline constexpr Unit(const Unit<Type2, Pack2>& p_other)
 		: m_value{metric_conversion<Type, unit_pack, Pack2>(p_other.value())}
 	{}
 
 	template<c_ValidFP Type2, c_proxy_property Prop2> requires
-		(is_compatible_unit_pack<unit_pack, typename Offset_Unit<Type2, Prop2>::unit_pack_t>::value)
+		c_compatible_unit_pack<unit_pack, typename Offset_Unit<Type2, Prop2>::unit_pack_t>
 	inline constexpr Unit(const Offset_Unit<Type2, Prop2>& p_other)
 		: Unit(p_other.to_unit())
 	{}
@@ -74,7 +64,7 @@ public:
 	inline Unit& operator = (const Unit&) = default;
 
 	template<c_ValidFP Type2, c_proxy_property Prop2> requires
-		(is_compatible_unit_pack<unit_pack, typename Offset_Unit<Type2, Prop2>::unit_pack_t>::value)
+		c_compatible_unit_pack<unit_pack, typename Offset_Unit<Type2, Prop2>::unit_pack_t>
 	inline Unit& operator = (const Offset_Unit<Type2, Prop2>& p_other)
 	{
 		return operator = (p_other.to_unit());
@@ -111,16 +101,7 @@ public:
 		return Unit{m_value + p_other.value()};
 	}
 
-	template <c_ValidFP Type2, c_unit_pack Pack2> requires
-		c_interchangeable_unit_pack<unit_pack, typename Unit<Type2, Pack2>::unit_pack>
-	inline constexpr auto operator + (const Unit<Type2, Pack2>& p_other) const
-	{
-		using vtype = decltype(std::declval<Type>() + std::declval<Type2>());
-		return Unit<vtype, Pack>{m_value + p_other.value()};
-	}
-
-	template <c_ValidFP Type2, c_unit_pack Pack2> requires
-		c_weak_compatible_unit_pack<unit_pack, typename Unit<Type2, Pack2>::unit_pack>
+	template <c_ValidFP Type2, c_unit_pack Pack2> requires c_compatible_unit_pack<unit_pack, Pack2>
 	inline constexpr auto operator + (const Unit<Type2, Pack2>& p_other) const
 	{
 		using vtype = decltype(std::declval<Type>() + std::declval<Type2>());
@@ -132,16 +113,7 @@ public:
 		return Unit{m_value - p_other.value()};
 	}
 
-	template <c_ValidFP Type2, c_unit_pack Pack2> requires
-		c_interchangeable_unit_pack<unit_pack, typename Unit<Type2, Pack2>::unit_pack>
-	inline constexpr auto operator - (const Unit<Type2, Pack2>& p_other) const
-	{
-		using vtype = decltype(std::declval<Type>() - std::declval<Type2>());
-		return Unit<vtype, Pack>{m_value - p_other.value()};
-	}
-
-	template <c_ValidFP Type2, c_unit_pack Pack2> requires
-		c_weak_compatible_unit_pack<unit_pack, typename Unit<Type2, Pack2>::unit_pack>
+	template <c_ValidFP Type2, c_unit_pack Pack2> requires c_compatible_unit_pack<unit_pack, Pack2>
 	inline constexpr auto operator - (const Unit<Type2, Pack2>& p_other) const
 	{
 		using vtype = decltype(std::declval<Type>() - std::declval<Type2>());
@@ -258,24 +230,6 @@ constexpr auto operator / (valueL_t p_left, const Unit<valueR_t, Pack2>& p_right
 
 
 
-}	//namespace unit::_p
-
-
-namespace unit
-{
-
-template<_p::c_ValidFP Type, core::c_pack Dimensions, core::c_pack Scalars>
-struct make_unit
-{
-private:
-	static_assert(!core::pack_contains_v<Dimensions, _p::not_dimension>, "Dimension pack can only contain dimensions");
-	static_assert(!core::pack_contains_v<Scalars, _p::not_scalar>, "Scalar pack can only contain scalars");
 
-	using sorted_dim	= typename _p::pack_selection_sort<Dimensions, _p::less>::type;
-	using sorted_scal	= typename _p::pack_selection_sort<Scalars, _p::less>::type;
 
-public:
-	using type = _p::Unit<Type, _p::unit_pack<sorted_dim, sorted_scal>>;
-};
-
-} //namespace unit
+}	//namespace unit::_p
@@ -25,7 +25,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
 #include <type_traits>
+#include <utility>
 #include <CoreLib/core_pack.hpp>
 
 namespace unit::_p
@@ -55,6 +60,10 @@ namespace unit::_p
 	concept c_arithmethic = std::is_arithmetic_v<T>;
 
 
+	/// \brief Assumed size of a cache line, used to keep data written by different threads apart
+	inline constexpr uintptr_t cache_line_size = 64;
+
+
 	/// \brief Multiplies elements in a pack
 	template<core::c_pack Pack_t, template <typename> typename Getter>
 	struct pack_multiply
@@ -81,43 +90,47 @@ namespace unit::_p
 	};
 
 
-	//======== ======== pack selection sort ======== ========
+	//======== ======== pack sort ======== ========
 	/// \brief Sorts elements in a pack
+	/// \note Every pair of elements is compared once into a table, the permutation is then resolved in a single constant evaluation
+	///	and the sorted pack is built from it in one step. Equivalent elements keep their relative order.
 	template <core::c_pack Pack_t, template <typename, typename> typename Comparator>
-	struct pack_selection_sort
+	struct pack_sort
 	{
 	private:
 		static constexpr uintptr_t pack_size = core::pack_count_v<Pack_t>;
 
+		template<typename T, typename... Ts>
+		static constexpr std::array<bool, sizeof...(Ts)> compare_row = {Comparator<T, Ts>::value...};
 
-		template <core::c_pack LoopPack, std::uintptr_t i, std::uintptr_t j>
-		struct pack_selection_sort_impl
+		template<typename... Ts>
+		static consteval std::array<uintptr_t, pack_size> permutation(core::pack<Ts...>*)
 		{
-			using pack_type = std::conditional_t<
-				Comparator<
-				core::pack_get_t<LoopPack, i>, core::pack_get_t<LoopPack, j>
-				>::value,
-				LoopPack,
-				typename core::pack_element_swap<LoopPack, i, j>::type
-			>;
-
-			using type = typename pack_selection_sort_impl<pack_type, i, j + 1>::type;
-		};
-
-		template <core::c_pack LoopPack, std::uintptr_t i>
-		struct pack_selection_sort_impl<LoopPack, i, pack_size>
-		{
-			using type = typename pack_selection_sort_impl<LoopPack, i + 1, i + 2>::type;
-		};
+			constexpr std::array<std::array<bool, pack_size>, pack_size> less_table = {compare_row<Ts, Ts...>...};
 
-		template <core::c_pack LoopPack, std::uintptr_t j>
-		struct pack_selection_sort_impl<LoopPack, pack_size, j>
-		{
-			using type = LoopPack;
-		};
+			std::array<uintptr_t, pack_size> t_order{};
+			for(uintptr_t i = 0; i < pack_size; ++i)
+			{
+				t_order[i] = i;
+			}
+
+			std::sort(t_order.begin(), t_order.end(),
+				[&less_table](uintptr_t p_lhs, uintptr_t p_rhs)
+				{
+					if(less_table[p_lhs][p_rhs]) return true;
+					if(less_table[p_rhs][p_lhs]) return false;
+					return p_lhs < p_rhs;
+				});
+			return t_order;
+		}
+
+		static constexpr std::array<uintptr_t, pack_size> order = permutation(static_cast<Pack_t*>(nullptr));
+
+		template<uintptr_t... Index>
+		static core::pack<core::pack_get_t<Pack_t, order[Index]>...> build(std::integer_sequence<uintptr_t, Index...>);
 
 	public:
-		using type = typename pack_selection_sort_impl<Pack_t, 0, 1>::type;
+		using type = decltype(build(std::make_integer_sequence<uintptr_t, pack_size>{}));
 	};
 
 
@@ -153,19 +166,56 @@ namespace unit::_p
 
 
 	//======== ======== compile time pow ======== ========
+	/// \brief Powers of 10, written as literals so that every entry is correctly rounded
+	inline constexpr long double pow10_table[] =
+	{
+		1e0l, 1e1l, 1e2l, 1e3l, 1e4l, 1e5l, 1e6l,
+		1e7l, 1e8l, 1e9l, 1e10l, 1e11l, 1e12l, 1e13l,
+		1e14l, 1e15l, 1e16l, 1e17l, 1e18l, 1e19l, 1e20l,
+		1e21l, 1e22l, 1e23l, 1e24l, 1e25l, 1e26l, 1e27l
+	};
+
+	/// \brief Negative powers of 10, pow10_table_negative[n] = 10^-n
+	inline constexpr long double pow10_table_negative[] =
+	{
+		1e-0l, 1e-1l, 1e-2l, 1e-3l, 1e-4l, 1e-5l, 1e-6l,
+		1e-7l, 1e-8l, 1e-9l, 1e-10l, 1e-11l, 1e-12l, 1e-13l,
+		1e-14l, 1e-15l, 1e-16l, 1e-17l, 1e-18l, 1e-19l, 1e-20l,
+		1e-21l, 1e-22l, 1e-23l, 1e-24l, 1e-25l, 1e-26l, 1e-27l
+	};
+
+	static_assert(std::size(pow10_table) == std::size(pow10_table_negative));
+
+	/// \brief Exponentiation by squaring
+	/// \note Powers of 10 within the tables are looked up instead, avoiding the rounding of intermediate products.
+	///	Powers of 2 are exact either way. Negative powers are computed as a single division of the positive power.
 	constexpr long double cpow(long double p_val, int8_t p_power)
 	{
 		//static_assert(std::is_constant_evaluated());
 
-		if(p_power > 0)
+		const uint8_t t_exponent = static_cast<uint8_t>(p_power < 0 ? -p_power : p_power);
+
+		if(p_val == 10.l && t_exponent < std::size(pow10_table))
 		{
-			return cpow(p_val, p_power - 1) * p_val;
+			return p_power < 0 ? pow10_table_negative[t_exponent] : pow10_table[t_exponent];
 		}
-		else if(p_power < 0)
+
+		long double t_result = 1.l;
+		long double t_base = p_val;
+		for(uint8_t t_bits = t_exponent; t_bits != 0;)
 		{
-			return cpow(p_val, p_power + 1) / p_val;
+			if(t_bits & 1)
+			{
+				t_result *= t_base;
+			}
+			t_bits >>= 1;
+			if(t_bits != 0)
+			{
+				t_base *= t_base;
+			}
 		}
-		return 1.l;
+
+		return p_power < 0 ? 1.l / t_result : t_result;
 	}
 
 	consteval long double pow(long double p_val, int8_t p_power) { return cpow(p_val, p_power); }
@@ -25,36 +25,5 @@
 
 #pragma once
 
-#include "standard/standard_angle.hpp"
+#include "fwd/alias_angle.hpp"
 #include "_p/unit_type.hpp"
-
-namespace unit
-{
-
-//======== ======== Template Type ======== ========
-
-template <_p::c_ValidFP T>
-using radian_t = typename make_unit<T, core::pack<_p::dimension<standard::radian, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using degree_t = typename make_unit<T, core::pack<_p::dimension<standard::degree, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using arc_minute_t = typename make_unit<T, core::pack<_p::dimension<standard::arc_minute, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using arc_second_t = typename make_unit<T, core::pack<_p::dimension<standard::arc_second, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using turn_t = typename make_unit<T, core::pack<_p::dimension<standard::turn, 1>>, core::pack<>>::type;
-
-
-//======== ======== Default Type ======== ========
-
-using radian		= radian_t		<_p::default_fp>;
-using degree		= degree_t		<_p::default_fp>;
-using arc_minute	= arc_minute_t	<_p::default_fp>;
-using arc_second	= arc_second_t	<_p::default_fp>;
-using turn			= turn_t		<_p::default_fp>;
-
-} //namespace unit
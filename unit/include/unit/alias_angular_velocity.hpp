@@ -25,24 +25,5 @@
 
 #pragma once
 
+#include "fwd/alias_angular_velocity.hpp"
 #include "_p/unit_type.hpp"
-#include "standard/standard_angle.hpp"
-#include "standard/standard_time.hpp"
-
-namespace unit
-{
-
-//======== ======== Template Type ======== ========
-template <_p::c_ValidFP T>
-using radians_per_second_t = typename make_unit<T, core::pack<_p::dimension<standard::radian, 1>, _p::dimension<standard::second, -1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using rotations_per_minute_t = typename make_unit<T, core::pack<_p::dimension<standard::turn, 1>, _p::dimension<standard::minute, -1>>, core::pack<>>::type;
-
-
-//======== ======== Default Type ======== ========
-using radians_per_second = radians_per_second_t<_p::default_fp>;
-using rotations_per_minute = rotations_per_minute_t<_p::default_fp>;
-
-
-} //namespace unit
@@ -25,49 +25,5 @@
 
 #pragma once
 
-#include "standard/standard_lenght.hpp"
-#include "standard/si_prefix.hpp"
+#include "fwd/alias_area.hpp"
 #include "_p/unit_type.hpp"
-
-namespace unit
-{
-
-namespace multi
-{
-struct square_yards_in_acre
-{
-	static constexpr long double factor = 4840.l;
-};
-} // namespace multi
-
-//======== ======== Template Type ======== ========
-template <_p::c_ValidFP T>
-using square_metre_t = typename make_unit<T, core::pack<_p::dimension<standard::metre, 2>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using square_foot_t = typename make_unit<T, core::pack<_p::dimension<standard::foot, 2>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using hectare_t = typename make_unit<T, core::pack<_p::dimension<standard::metre, 2>>, core::pack<multi::hecto<2>>>::type;
-
-template <_p::c_ValidFP T>
-using acre_t = typename make_unit<T, core::pack<_p::dimension<standard::yard, 2>>, core::pack<_p::scalar<multi::square_yards_in_acre, 1>>>::type;
-
-template <_p::c_ValidFP T>
-using square_mile_t = typename make_unit<T, core::pack<_p::dimension<standard::mile, 2>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using square_kilo_metre_t = typename make_unit<T, core::pack<_p::dimension<standard::metre, 2>>, core::pack<multi::kilo<2>>>::type;
-
-//======== ======== Default Type ======== ========
-
-using square_metre	= square_metre_t<_p::default_fp>;
-using square_foot	= square_foot_t	<_p::default_fp>;
-using hectare		= hectare_t		<_p::default_fp>;
-using acre			= acre_t		<_p::default_fp>;
-using square_mile	= square_mile_t	<_p::default_fp>;
-
-using square_kilo_metre	= square_kilo_metre_t<_p::default_fp>;
-
-
-} //namespace unit
@@ -25,25 +25,5 @@
 
 #pragma once
 
+#include "fwd/alias_density.hpp"
 #include "_p/unit_type.hpp"
-#include "standard/standard_mass.hpp"
-#include "standard/standard_lenght.hpp"
-
-
-namespace unit
-{
-//======== ======== Template Type ======== ========
-
-template <_p::c_ValidFP T>
-using kilogram_per_cubic_metre_t = typename make_unit<T, core::pack<_p::dimension<standard::si_mass, 1>, _p::dimension<standard::metre, -3>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using pound_av_per_cubic_feet_t = typename make_unit<T, core::pack<_p::dimension<standard::pound_av, 1>, _p::dimension<standard::foot, -3>>, core::pack<>>::type;
-
-
-//======== ======== Default Type ======== ========
-
-using kilogram_per_cubic_metre = kilogram_per_cubic_metre_t<_p::default_fp>;
-using pound_av_per_cubic_feet = pound_av_per_cubic_feet_t<_p::default_fp>;
-
-} //namespace unit
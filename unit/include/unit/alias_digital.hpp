@@ -25,58 +25,5 @@
 
 #pragma once
 
+#include "fwd/alias_digital.hpp"
 #include "_p/unit_type.hpp"
-#include "standard/standard_digital.hpp"
-#include "standard/digital_prefix.hpp"
-
-namespace unit
-{
-
-//======== ======== Template Type ======== ========
-template <_p::c_ValidFP T>
-using bit_t = typename make_unit<T, core::pack<_p::dimension<standard::bit, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using byte_t = typename make_unit<T, core::pack<_p::dimension<standard::byte, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using doublet_t = typename make_unit<T, core::pack<_p::dimension<standard::doublet, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using quadlet_t = typename make_unit<T, core::pack<_p::dimension<standard::quadlet, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using octlet_t = typename make_unit<T, core::pack<_p::dimension<standard::octlet, 1>>, core::pack<>>::type;
-
-
-template <_p::c_ValidFP T>
-using kibibyte_t = typename make_unit<T, core::pack<_p::dimension<standard::byte, 1>>, core::pack<multi::kibi<1>>>::type;
-
-template <_p::c_ValidFP T>
-using mebibyte_t = typename make_unit<T, core::pack<_p::dimension<standard::byte, 1>>, core::pack<multi::mebi<1>>>::type;
-
-template <_p::c_ValidFP T>
-using gibibyte_t = typename make_unit<T, core::pack<_p::dimension<standard::byte, 1>>, core::pack<multi::gibi<1>>>::type;
-
-template <_p::c_ValidFP T>
-using tebibyte_t = typename make_unit<T, core::pack<_p::dimension<standard::byte, 1>>, core::pack<multi::tebi<1>>>::type;
-
-template <_p::c_ValidFP T>
-using pebibyte_t = typename make_unit<T, core::pack<_p::dimension<standard::byte, 1>>, core::pack<multi::pebi<1>>>::type;
-
-//======== ======== Default Type ======== ========
-
-
-using bit		= bit_t		<_p::default_fp>;
-using byte		= byte_t	<_p::default_fp>;
-using doublet	= doublet_t	<_p::default_fp>;
-using quadlet	= quadlet_t	<_p::default_fp>;
-using octlet	= octlet_t	<_p::default_fp>;
-
-using kibibyte = kibibyte_t<_p::default_fp>;
-using mebibyte = mebibyte_t<_p::default_fp>;
-using gibibyte = gibibyte_t<_p::default_fp>;
-using tebibyte = tebibyte_t<_p::default_fp>;
-using pebibyte = pebibyte_t<_p::default_fp>;
-
-} //namespace unit
@@ -25,31 +25,5 @@
 
 #pragma once
 
+#include "fwd/alias_electrical.hpp"
 #include "_p/unit_type.hpp"
-#include "standard/standard_charge.hpp"
-#include "standard/standard_time.hpp"
-#include "standard/standard_mass.hpp"
-#include "standard/standard_lenght.hpp"
-
-namespace unit
-{
-
-//======== ======== Template Type ======== ========
-template <_p::c_ValidFP T>
-using ampere_t = typename make_unit<T, core::pack<_p::dimension<standard::coloumb, 1>, _p::dimension<standard::second, -1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using volt_t = typename make_unit<T, core::pack<_p::dimension<standard::si_mass, 1>, _p::dimension<standard::metre, 2>, _p::dimension<standard::second, -2>, _p::dimension<standard::coloumb, -1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using ohm_t = typename make_unit<T, core::pack<_p::dimension<standard::si_mass, 1>, _p::dimension<standard::metre, 2>, _p::dimension<standard::second, 1>, _p::dimension<standard::coloumb, -2>>, core::pack<>>::type;
-
-
-//======== ======== Default Type ======== ========
-
-using ampere	= ampere_t	<_p::default_fp>;
-using volt		= volt_t	<_p::default_fp>;
-using ohm		= ohm_t		<_p::default_fp>;
-
-
-} //namespace unit
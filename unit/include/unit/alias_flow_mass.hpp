@@ -25,25 +25,5 @@
 
 #pragma once
 
+#include "fwd/alias_flow_mass.hpp"
 #include "_p/unit_type.hpp"
-#include "standard/standard_mass.hpp"
-#include "standard/standard_time.hpp"
-
-namespace unit
-{
-
-//======== ======== Template Type ======== ========
-
-template <_p::c_ValidFP T>
-using kilogram_per_second_t = typename make_unit<T, core::pack<_p::dimension<standard::si_mass, 1>, _p::dimension<standard::second, -1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using pound_av_per_second_t = typename make_unit<T, core::pack<_p::dimension<standard::pound_av, 1>, _p::dimension<standard::second, -1>>, core::pack<>>::type;
-
-
-//======== ======== Default Type ======== ========
-
-using kilogram_per_second = kilogram_per_second_t<_p::default_fp>;
-using pound_av_per_second = pound_av_per_second_t<_p::default_fp>;
-
-} //namespace unit
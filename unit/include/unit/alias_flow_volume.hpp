@@ -25,25 +25,5 @@
 
 #pragma once
 
+#include "fwd/alias_flow_volume.hpp"
 #include "_p/unit_type.hpp"
-#include "standard/standard_lenght.hpp"
-#include "standard/standard_time.hpp"
-
-namespace unit
-{
-
-//======== ======== Template Type ======== ========
-
-template <_p::c_ValidFP T>
-using cubic_metre_per_second_t = typename make_unit<T, core::pack<_p::dimension<standard::metre, 3>, _p::dimension<standard::second, -1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using cubic_foot_per_second_t = typename make_unit<T, core::pack<_p::dimension<standard::foot, 3>, _p::dimension<standard::second, -1>>, core::pack<>>::type;
-
-
-//======== ======== Default Type ======== ========
-
-using cubic_metres_per_second	= cubic_metre_per_second_t	<_p::default_fp>;
-using cubic_foot_per_second		= cubic_foot_per_second_t	<_p::default_fp>;
-
-} //namespace unit
@@ -25,35 +25,5 @@
 
 #pragma once
 
+#include "fwd/alias_force.hpp"
 #include "_p/unit_type.hpp"
-
-#include "standard/standard_mass.hpp"
-#include "standard/standard_lenght.hpp"
-#include "standard/standard_time.hpp"
-
-namespace unit
-{
-
-//======== ======== Template Type ======== ========
-
-template <_p::c_ValidFP T>
-using newton_t = typename make_unit<T, core::pack<_p::dimension<standard::si_mass, 1>, _p::dimension<standard::metre, 1>, _p::dimension<standard::second, -2>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using kilogram_force_t = typename make_unit<T, core::pack<_p::dimension<standard::si_mass, 1>, _p::dimension<standard::metre, 1>, _p::dimension<standard::second, -2>>, core::pack<_p::scalar<multi::g0_si, 1>>>::type;
-
-template <_p::c_ValidFP T>
-using pound_av_force_t = typename make_unit<T, core::pack<_p::dimension<standard::pound_av, 1>, _p::dimension<standard::foot, 1>, _p::dimension<standard::second, -2>>, core::pack<_p::scalar<multi::g0_imp, 1>>>::type;
-
-template <_p::c_ValidFP T>
-using poundal_t = typename make_unit<T, core::pack<_p::dimension<standard::pound_av, 1>, _p::dimension<standard::foot, 1>, _p::dimension<standard::second, -2>>, core::pack<>>::type;
-
-
-//======== ======== Default Type ======== ========
-
-using newton			= newton_t			<_p::default_fp>;
-using kilogram_force	= kilogram_force_t	<_p::default_fp>;
-using pound_av_force	= pound_av_force_t	<_p::default_fp>;
-using poundal			= poundal_t			<_p::default_fp>;
-
-} //namespace unit
\ No newline at end of file
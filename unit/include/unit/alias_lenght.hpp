@@ -25,77 +25,5 @@
 
 #pragma once
 
-#include "standard/standard_lenght.hpp"
-#include "standard/si_prefix.hpp"
-
+#include "fwd/alias_lenght.hpp"
 #include "_p/unit_type.hpp"
-
-namespace unit
-{
-
-//======== ======== Template Type ======== ========
-
-constexpr bool val = _p::is_dimension<_p::dimension<standard::metre, 1>>::value;
-
-
-
-template <_p::c_ValidFP T>
-using metre_t = typename make_unit<T, core::pack<_p::dimension<standard::metre, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using foot_t = typename make_unit<T, core::pack<_p::dimension<standard::foot, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using inch_t = typename make_unit<T, core::pack<_p::dimension<standard::inch, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using yard_t = typename make_unit<T, core::pack<_p::dimension<standard::yard, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using mile_t = typename make_unit<T, core::pack<_p::dimension<standard::mile, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using nautical_mile_t = typename make_unit<T, core::pack<_p::dimension<standard::nautical_mile, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using light_second_t = typename make_unit<T, core::pack<_p::dimension<standard::light_second, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using light_year_t = typename make_unit<T, core::pack<_p::dimension<standard::light_year, 1>>, core::pack<>>::type;
-
-
-
-template <_p::c_ValidFP T>
-using nano_metre_t = typename make_unit<T, core::pack<_p::dimension<standard::metre, 1>>, core::pack<multi::nano<1>>>::type;
-
-template <_p::c_ValidFP T>
-using micro_metre_t = typename make_unit<T, core::pack<_p::dimension<standard::metre, 1>>, core::pack<multi::micro<1>>>::type;
-
-template <_p::c_ValidFP T>
-using milli_metre_t = typename make_unit<T, core::pack<_p::dimension<standard::metre, 1>>, core::pack<multi::milli<1>>>::type;
-
-template <_p::c_ValidFP T>
-using centi_metre_t = typename make_unit<T, core::pack<_p::dimension<standard::metre, 1>>, core::pack<multi::centi<1>>>::type;
-
-template <_p::c_ValidFP T>
-using kilo_metre_t = typename make_unit<T, core::pack<_p::dimension<standard::metre, 1>>, core::pack<multi::kilo<1>>>::type;
-
-//======== ======== Default Type ======== ========
-
-using metre			= metre_t			<_p::default_fp>;
-using foot			= foot_t			<_p::default_fp>;
-using inch			= inch_t			<_p::default_fp>;
-using yard			= yard_t			<_p::default_fp>;
-using mile			= mile_t			<_p::default_fp>;
-using nautical_mile	= nautical_mile_t	<_p::default_fp>;
-using light_second	= light_second_t	<_p::default_fp>;
-using light_year	= light_year_t		<_p::default_fp>;
-
-
-using nano_metre	= nano_metre_t		<_p::default_fp>;
-using micro_metre	= micro_metre_t		<_p::default_fp>;
-using milli_metre	= milli_metre_t		<_p::default_fp>;
-using centi_metre	= centi_metre_t		<_p::default_fp>;
-using kilo_metre	= kilo_metre_t		<_p::default_fp>;
-
-} //namespace unit
@@ -25,20 +25,5 @@
 
 #pragma once
 
-#include "standard/standard_luminosity.hpp"
+#include "fwd/alias_luminosity.hpp"
 #include "_p/unit_type.hpp"
-
-namespace unit
-{
-
-//======== ======== Template Type ======== ========
-
-template <_p::c_ValidFP T>
-using candela_t = typename make_unit<T, core::pack<_p::dimension<standard::candela, 1>>, core::pack<>>::type;
-
-
-//======== ======== Default Type ======== ========
-
-using candela = candela_t<_p::default_fp>;
-
-} //namespace unit
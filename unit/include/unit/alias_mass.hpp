@@ -25,36 +25,5 @@
 
 #pragma once
 
-#include "standard/standard_mass.hpp"
-#include "standard/si_prefix.hpp"
+#include "fwd/alias_mass.hpp"
 #include "_p/unit_type.hpp"
-
-namespace unit
-{
-
-//======== ======== Template Type ======== ========
-
-template <_p::c_ValidFP T>
-using kilogram_t = typename make_unit<T, core::pack<_p::dimension<standard::si_mass, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using gram_t = typename make_unit<T, core::pack<_p::dimension<standard::gram, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using pound_av_t = typename make_unit<T, core::pack<_p::dimension<standard::pound_av, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using ounce_av_t = typename make_unit<T, core::pack<_p::dimension<standard::ounce_av, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using tonne_t = typename make_unit<T, core::pack<_p::dimension<standard::si_mass, 1>>, core::pack<_p::scalar<multi::E, 3>>>::type;
-
-//======== ======== Default Type ======== ========
-
-using kilogram	= kilogram_t<_p::default_fp>;
-using gram		= gram_t	<_p::default_fp>;
-using pound_av	= pound_av_t<_p::default_fp>;
-using ounce_av	= ounce_av_t<_p::default_fp>;
-using tonne		= tonne_t	<_p::default_fp>;
-
-} //namespace unit
@@ -25,22 +25,5 @@
 
 #pragma once
 
+#include "fwd/alias_power.hpp"
 #include "_p/unit_type.hpp"
-#include "standard/standard_mass.hpp"
-#include "standard/standard_lenght.hpp"
-#include "standard/standard_time.hpp"
-
-namespace unit
-{
-
-//======== ======== Template Type ======== ========
-
-template <_p::c_ValidFP T>
-using watt_t = typename make_unit<T, core::pack<_p::dimension<standard::si_mass, 1>, _p::dimension<standard::metre, 2>, _p::dimension<standard::second, -3>>, core::pack<>>::type;
-
-
-//======== ======== Default Type ======== ========
-
-using watt = watt_t<_p::default_fp>;
-
-} //namespace unit
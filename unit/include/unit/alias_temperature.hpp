@@ -25,34 +25,6 @@
 
 #pragma once
 
-#include "standard/standard_temperature.hpp"
+#include "fwd/alias_temperature.hpp"
 #include "_p/unit_type.hpp"
 #include "_p/offset_unit.hpp"
-
-namespace unit
-{
-
-//======== ======== Template Type ======== ========
-
-template <_p::c_ValidFP T>
-using kelvin_t = typename make_unit<T, core::pack<_p::dimension<standard::kelvin, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using rankine_t = typename make_unit<T, core::pack<_p::dimension<standard::rankine, 1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using celcius_t = _p::Offset_Unit<T, standard::celcius>;
-
-template <_p::c_ValidFP T>
-using fahrenheit_t = _p::Offset_Unit<T, standard::fahrenheit>;
-
-
-//======== ======== Default Type ======== ========
-
-using kelvin	= kelvin_t	<_p::default_fp>;
-using rankine	= rankine_t	<_p::default_fp>;
-
-using celcius		= celcius_t		<_p::default_fp>;
-using fahrenheit	= fahrenheit_t	<_p::default_fp>;
-
-} //namespace unit
@@ -25,26 +25,5 @@
 
 #pragma once
 
+#include "fwd/alias_torque.hpp"
 #include "_p/unit_type.hpp"
-#include "standard/standard_mass.hpp"
-#include "standard/standard_lenght.hpp"
-#include "standard/standard_time.hpp"
-#include "standard/standard_angle.hpp"
-#include "standard/multipliers.hpp"
-
-namespace unit
-{
-
-//======== ======== Template Type ======== ========
-template <_p::c_ValidFP T>
-using newton_metre_t = typename make_unit<T, core::pack<_p::dimension<standard::si_mass, 1>, _p::dimension<standard::metre, 2>, _p::dimension<standard::second, -2>, _p::dimension<standard::radian, -1>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using pound_av_force_foot_t = typename make_unit<T, core::pack<_p::dimension<standard::pound_av, 1>, _p::dimension<standard::foot, 2>, _p::dimension<standard::second, -2>, _p::dimension<standard::radian, -1>>, core::pack<_p::scalar<multi::g0_imp, 1>>>::type;
-
-
-//======== ======== Default Type ======== ========
-using newton_metre			= newton_metre_t		<_p::default_fp>;
-using pound_av_force_foot	= pound_av_force_foot_t	<_p::default_fp>;
-
-} //namespace unit
@@ -25,52 +25,5 @@
 
 #pragma once
 
-#include "standard/standard_lenght.hpp"
-#include "standard/si_prefix.hpp"
+#include "fwd/alias_volume.hpp"
 #include "_p/unit_type.hpp"
-
-
-namespace unit
-{
-
-namespace multi
-{
-struct cubic_metres_in_gallon
-{
-	static constexpr long double factor = 4.546'09E-3l;
-};
-
-struct cubic_metres_in_pint
-{
-	static constexpr long double factor = cubic_metres_in_gallon::factor / 8.l;
-};
-} //namespace multi
-
-
-//======== ======== Template Type ======== ========
-
-template <_p::c_ValidFP T>
-using cubic_metre_t = typename make_unit<T, core::pack<_p::dimension<standard::metre, 3>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using litre_t = typename make_unit<T, core::pack<_p::dimension<standard::metre, 3>>, core::pack<multi::deci<3>>>::type;
-
-template <_p::c_ValidFP T>
-using cubic_foot_t = typename make_unit<T, core::pack<_p::dimension<standard::foot, 3>>, core::pack<>>::type;
-
-template <_p::c_ValidFP T>
-using gallon_t = typename make_unit<T, core::pack<_p::dimension<standard::metre, 3>>, core::pack<_p::scalar<multi::cubic_metres_in_gallon, 1>>>::type;
-
-template <_p::c_ValidFP T>
-using pint_t = typename make_unit<T, core::pack<_p::dimension<standard::metre, 3>>, core::pack<_p::scalar<multi::cubic_metres_in_pint, 1>>>::type;
-
-
-//======== ======== Default Type ======== ========
-
-using cubic_metre	= cubic_metre_t	<_p::default_fp>;
-using litre			= litre_t		<_p::default_fp>;
-using cubic_foot	= cubic_foot_t	<_p::default_fp>;
-using gallon		= gallon_t		<_p::default_fp>;
-using pint			= pint_t		<_p::default_fp>;
-
-} //namespace unit
@@ -0,0 +1,230 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <system_error>
+#include <type_traits>
+
+#include "unit_descriptor.hpp"
+#include "unit_format.hpp"
+
+namespace unit
+{
+
+namespace _p
+{
+	template<typename T>
+	concept c_any_storable = (c_unit<T> || c_offset_unit<T>) && requires { descriptor_of<T>::value; };
+
+	inline constexpr uint64_t fingerprint_mix(uint64_t p_hash, uint64_t p_value)
+	{
+		p_hash = (p_hash ^ p_value) * 0x9E3779B97F4A7C15;
+		return p_hash ^ (p_hash >> 29);
+	}
+
+	/// \brief Compile-time fingerprint of a unit type, same descriptor and value type give the same fingerprint
+	template<c_any_storable Unit_t>
+	inline constexpr uint64_t unit_fingerprint_v =
+		fingerprint_mix(
+			fingerprint_mix(
+				fingerprint_mix(
+					fingerprint_mix(sizeof(typename Unit_t::value_t), descriptor_of<Unit_t>::value.signature().word()),
+					std::bit_cast<uint64_t>(descriptor_of<Unit_t>::value.gauge())),
+				std::bit_cast<uint64_t>(descriptor_of<Unit_t>::value.offset())),
+			c_offset_unit<Unit_t> ? 1 : 0);
+
+	/// \brief Operations on a unit type held by any_unit
+	struct any_unit_ops
+	{
+		uint64_t fingerprint;
+		unit_descriptor descriptor;
+		long double (*value)(const std::byte* p_storage);
+		/// \param p_format - std::chars_format{} for the shortest representation
+		/// \param p_precision - negative for no precision
+		std::to_chars_result (*format)(const std::byte* p_storage, char* p_first, char* p_last, std::chars_format p_format, int p_precision);
+	};
+
+	template<c_any_storable Unit_t>
+	inline Unit_t any_unit_load(const std::byte* p_storage)
+	{
+		Unit_t t_unit;
+		std::memcpy(&t_unit, p_storage, sizeof(Unit_t));
+		return t_unit;
+	}
+
+	template<c_any_storable Unit_t>
+	inline long double any_unit_value(const std::byte* p_storage)
+	{
+		return static_cast<long double>(any_unit_load<Unit_t>(p_storage).value());
+	}
+
+	template<c_any_storable Unit_t>
+	inline std::to_chars_result any_unit_format(const std::byte* p_storage, char* p_first, char* p_last, std::chars_format p_format, int p_precision)
+	{
+		if constexpr(c_formattable_unit<Unit_t>)
+		{
+			const Unit_t t_unit = any_unit_load<Unit_t>(p_storage);
+			if(p_format == std::chars_format{})
+			{
+				return to_chars(p_first, p_last, t_unit);
+			}
+			if(p_precision < 0)
+			{
+				return to_chars(p_first, p_last, t_unit, p_format);
+			}
+			return to_chars(p_first, p_last, t_unit, p_format, p_precision);
+		}
+		else
+		{
+			return std::to_chars_result{p_first, std::errc::invalid_argument};
+		}
+	}
+
+	template<c_any_storable Unit_t>
+	inline constexpr any_unit_ops any_unit_ops_v
+	{
+		unit_fingerprint_v<Unit_t>,
+		descriptor_of<Unit_t>::value,
+		&any_unit_value<Unit_t>,
+		&any_unit_format<Unit_t>
+	};
+} //namespace _p
+
+
+/// \brief Holds a unit or offset unit of any type by value
+/// \details The value is kept in inline storage, never on the heap, next to a pointer to a static table of operations for its type.
+///	The object is trivially copyable, suitable for message queues.
+class any_unit
+{
+public:
+	static constexpr uintptr_t storage_size = sizeof(long double);
+
+public:
+	inline constexpr any_unit() = default;
+
+	template<_p::c_any_storable Unit_t>
+	inline any_unit(const Unit_t& p_unit)
+		: m_ops{&_p::any_unit_ops_v<Unit_t>}
+	{
+		static_assert(sizeof(Unit_t) <= storage_size && alignof(Unit_t) <= alignof(long double));
+		static_assert(std::is_trivially_copyable_v<Unit_t>);
+		std::memcpy(m_storage.data(), &p_unit, sizeof(Unit_t));
+	}
+
+	inline bool has_value() const { return m_ops != nullptr; }
+	inline void reset() { m_ops = nullptr; }
+
+	/// \brief Descriptor of the held unit
+	/// \pre has_value()
+	inline const unit_descriptor& descriptor() const { return m_ops->descriptor; }
+
+	/// \brief Fingerprint of the held unit type, 0 if empty
+	inline uint64_t fingerprint() const { return m_ops ? m_ops->fingerprint : 0; }
+
+	inline bool compatible(const unit_descriptor& p_other) const
+	{
+		return m_ops && m_ops->descriptor.compatible(p_other);
+	}
+
+	inline bool compatible(const any_unit& p_other) const
+	{
+		return p_other.m_ops && compatible(p_other.m_ops->descriptor);
+	}
+
+	/// \brief Converts the held unit to Unit_t
+	/// \return std::nullopt if empty or not compatible
+	template<_p::c_any_storable Unit_t>
+	inline std::optional<Unit_t> to() const
+	{
+		if(!m_ops)
+		{
+			return std::nullopt;
+		}
+		using value_t = typename Unit_t::value_t;
+		const std::optional<affine_conversion> t_conversion = make_conversion(m_ops->descriptor, unit_descriptor_v<Unit_t>);
+		if(!t_conversion)
+		{
+			return std::nullopt;
+		}
+		return Unit_t{t_conversion->apply(static_cast<value_t>(m_ops->value(m_storage.data())))};
+	}
+
+private:
+	template<_p::c_any_storable Unit_t>
+	friend std::optional<Unit_t> any_cast(const any_unit& p_any);
+
+	friend std::to_chars_result to_chars(char* p_first, char* p_last, const any_unit& p_any, std::chars_format p_format, int p_precision);
+
+private:
+	alignas(long double) std::array<std::byte, storage_size> m_storage{};
+	const _p::any_unit_ops* m_ops = nullptr;
+};
+
+
+/// \brief Retrieves the held unit as Unit_t without conversion
+/// \return std::nullopt if the held unit does not have the same fingerprint
+/// \note Interchangeable units with the same value type share the fingerprint and are accepted.
+template<_p::c_any_storable Unit_t>
+inline std::optional<Unit_t> any_cast(const any_unit& p_any)
+{
+	if(!p_any.m_ops || p_any.m_ops->fingerprint != _p::unit_fingerprint_v<Unit_t> || p_any.m_ops->descriptor != unit_descriptor_v<Unit_t>)
+	{
+		return std::nullopt;
+	}
+	return _p::any_unit_load<Unit_t>(p_any.m_storage.data());
+}
+
+
+//======== ======== to_chars ======== ========
+//	Same overloads as to_chars for units, formats the held unit. Empty or non formattable units give std::errc::invalid_argument.
+
+inline std::to_chars_result to_chars(char* p_first, char* p_last, const any_unit& p_any, std::chars_format p_format, int p_precision)
+{
+	if(!p_any.m_ops)
+	{
+		return std::to_chars_result{p_first, std::errc::invalid_argument};
+	}
+	return p_any.m_ops->format(p_any.m_storage.data(), p_first, p_last, p_format, p_precision);
+}
+
+inline std::to_chars_result to_chars(char* p_first, char* p_last, const any_unit& p_any, std::chars_format p_format)
+{
+	return to_chars(p_first, p_last, p_any, p_format, -1);
+}
+
+inline std::to_chars_result to_chars(char* p_first, char* p_last, const any_unit& p_any)
+{
+	return to_chars(p_first, p_last, p_any, std::chars_format{}, -1);
+}
+
+} //namespace unit
@@ -0,0 +1,239 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <optional>
+
+#include "_p/utils.hpp"
+#include "unit_descriptor.hpp"
+
+namespace unit
+{
+
+/// \brief Bounded cache of conversions between pairs of runtime units
+/// \tparam Capacity - Number of slots, must be a power of 2
+/// \details Each slot holds a pair of descriptors and their affine conversion, covering units with an offset like celcius.
+///	Lookups probe a short window of slots starting at the hash of the pair.
+///	Reads are lock-free, each slot is protected by a sequence counter that readers validate (seqlock), and writers never wait:
+///	a writer that finds a slot being written skips caching instead. When the window is full the home slot is replaced.
+/// \note Storage is held inline, the cache never allocates.
+template<uintptr_t Capacity = 1024>
+class conversion_cache
+{
+public:
+	static constexpr uintptr_t capacity = Capacity;
+	static constexpr uintptr_t probe_count = Capacity < 4 ? Capacity : 4;
+
+	static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
+
+private:
+	static constexpr uintptr_t mask = Capacity - 1;
+
+	struct key
+	{
+		uint64_t signature;
+		uint64_t from_gauge;
+		uint64_t from_offset;
+		uint64_t to_gauge;
+		uint64_t to_offset;
+
+		inline bool operator == (const key&) const = default;
+	};
+
+	struct alignas(_p::cache_line_size) slot
+	{
+		//0 means empty, odd means being written
+		std::atomic<uint64_t> sequence{0};
+		std::atomic<uint64_t> signature{0};
+		std::atomic<uint64_t> from_gauge{0};
+		std::atomic<uint64_t> from_offset{0};
+		std::atomic<uint64_t> to_gauge{0};
+		std::atomic<uint64_t> to_offset{0};
+		std::atomic<uint64_t> scale{0};
+		std::atomic<uint64_t> shift{0};
+	};
+
+public:
+	conversion_cache() = default;
+	conversion_cache(const conversion_cache&) = delete;
+	conversion_cache& operator = (const conversion_cache&) = delete;
+
+	/// \brief Conversion from one unit to another, computed and cached on a miss
+	/// \return std::nullopt if units are not compatible
+	inline std::optional<affine_conversion> get(const unit_descriptor& p_from, const unit_descriptor& p_to)
+	{
+		if(!p_from.compatible(p_to))
+		{
+			return std::nullopt;
+		}
+
+		const key t_key = make_key(p_from, p_to);
+		const uintptr_t t_home = hash(t_key) & mask;
+
+		if(const std::optional<affine_conversion> t_cached = lookup(t_key, t_home))
+		{
+			return t_cached;
+		}
+
+		const std::optional<affine_conversion> t_conversion = make_conversion(p_from, p_to);
+		if(t_conversion)
+		{
+			insert(t_key, t_home, *t_conversion);
+		}
+		return t_conversion;
+	}
+
+	/// \brief Cached conversion from one unit to another, never computes it
+	/// \return std::nullopt if not cached or units are not compatible
+	inline std::optional<affine_conversion> find(const unit_descriptor& p_from, const unit_descriptor& p_to) const
+	{
+		if(!p_from.compatible(p_to))
+		{
+			return std::nullopt;
+		}
+
+		const key t_key = make_key(p_from, p_to);
+		return lookup(t_key, hash(t_key) & mask);
+	}
+
+	/// \brief Converts a value from one unit to another
+	/// \return std::nullopt if units are not compatible
+	template<_p::c_ValidFP Type>
+	inline std::optional<Type> convert(Type p_value, const unit_descriptor& p_from, const unit_descriptor& p_to)
+	{
+		const std::optional<affine_conversion> t_conversion = get(p_from, p_to);
+		if(!t_conversion)
+		{
+			return std::nullopt;
+		}
+		return t_conversion->apply(p_value);
+	}
+
+private:
+	//only compatible pairs are keyed, both sides share the signature
+	static inline key make_key(const unit_descriptor& p_from, const unit_descriptor& p_to)
+	{
+		return key
+		{
+			p_from.signature().word(),
+			std::bit_cast<uint64_t>(p_from.gauge()),
+			std::bit_cast<uint64_t>(p_from.offset()),
+			std::bit_cast<uint64_t>(p_to.gauge()),
+			std::bit_cast<uint64_t>(p_to.offset())
+		};
+	}
+
+	static inline uint64_t mix(uint64_t p_hash, uint64_t p_value)
+	{
+		p_hash ^= p_value + 0x9E3779B97F4A7C15 + (p_hash << 6) + (p_hash >> 2);
+		return p_hash;
+	}
+
+	static inline uintptr_t hash(const key& p_key)
+	{
+		uint64_t t_hash = mix(mix(mix(mix(p_key.signature, p_key.from_gauge), p_key.from_offset), p_key.to_gauge), p_key.to_offset);
+		t_hash ^= t_hash >> 33;
+		t_hash *= 0xFF51AFD7ED558CCD;
+		t_hash ^= t_hash >> 33;
+		return static_cast<uintptr_t>(t_hash);
+	}
+
+	inline std::optional<affine_conversion> lookup(const key& p_key, uintptr_t p_home) const
+	{
+		for(uintptr_t i = 0; i < probe_count; ++i)
+		{
+			const slot& t_slot = m_slots[(p_home + i) & mask];
+
+			const uint64_t t_before = t_slot.sequence.load(std::memory_order_acquire);
+			if(t_before == 0)
+			{
+				//slots are filled in probe order, nothing further
+				return std::nullopt;
+			}
+
+			const key t_key
+			{
+				t_slot.signature.load(std::memory_order_relaxed),
+				t_slot.from_gauge.load(std::memory_order_relaxed),
+				t_slot.from_offset.load(std::memory_order_relaxed),
+				t_slot.to_gauge.load(std::memory_order_relaxed),
+				t_slot.to_offset.load(std::memory_order_relaxed)
+			};
+			const uint64_t t_scale = t_slot.scale.load(std::memory_order_relaxed);
+			const uint64_t t_shift = t_slot.shift.load(std::memory_order_relaxed);
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+			const uint64_t t_after = t_slot.sequence.load(std::memory_order_relaxed);
+
+			if(t_before == t_after && (t_before & 1) == 0 && t_key == p_key)
+			{
+				return affine_conversion{std::bit_cast<double>(t_scale), std::bit_cast<double>(t_shift)};
+			}
+		}
+		return std::nullopt;
+	}
+
+	inline void insert(const key& p_key, uintptr_t p_home, const affine_conversion& p_conversion)
+	{
+		slot* t_target = &m_slots[p_home];
+		for(uintptr_t i = 0; i < probe_count; ++i)
+		{
+			slot& t_slot = m_slots[(p_home + i) & mask];
+			if(t_slot.sequence.load(std::memory_order_relaxed) == 0)
+			{
+				t_target = &t_slot;
+				break;
+			}
+		}
+
+		uint64_t t_sequence = t_target->sequence.load(std::memory_order_relaxed);
+		if((t_sequence & 1) != 0 || !t_target->sequence.compare_exchange_strong(t_sequence, t_sequence + 1, std::memory_order_relaxed))
+		{
+			//another writer owns the slot
+			return;
+		}
+		std::atomic_thread_fence(std::memory_order_release);
+
+		t_target->signature.store(p_key.signature, std::memory_order_relaxed);
+		t_target->from_gauge.store(p_key.from_gauge, std::memory_order_relaxed);
+		t_target->from_offset.store(p_key.from_offset, std::memory_order_relaxed);
+		t_target->to_gauge.store(p_key.to_gauge, std::memory_order_relaxed);
+		t_target->to_offset.store(p_key.to_offset, std::memory_order_relaxed);
+		t_target->scale.store(std::bit_cast<uint64_t>(p_conversion.scale), std::memory_order_relaxed);
+		t_target->shift.store(std::bit_cast<uint64_t>(p_conversion.shift), std::memory_order_relaxed);
+
+		t_target->sequence.store(t_sequence + 2, std::memory_order_release);
+	}
+
+private:
+	std::array<slot, Capacity> m_slots;
+};
+
+} //namespace unit
@@ -0,0 +1,108 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <ranges>
+#include <type_traits>
+
+#include "_p/unit_type.hpp"
+#include "parallel.hpp"
+
+namespace unit
+{
+
+/// \brief Result of integrating samples of type Sample_t over an axis of type Axis_t (ex. metre_per_second over second gives metre)
+template<typename Sample_t, typename Axis_t>
+using integral_t = std::remove_cvref_t<decltype(std::declval<const Sample_t&>() * std::declval<const Axis_t&>())>;
+
+} //namespace unit
+
+
+namespace unit::parallel
+{
+
+/// \brief Cumulative trapezoid integration of p_samples over the axis p_axis
+/// \details p_out[0] = 0, p_out[i] = p_out[i - 1] + (p_samples[i] + p_samples[i - 1]) * (p_axis[i] - p_axis[i - 1]) / 2
+/// \note Only the length common to all ranges is processed
+template<std::ranges::contiguous_range Sample_r, std::ranges::contiguous_range Axis_r, std::ranges::contiguous_range Out_r> requires
+	std::is_same_v<std::ranges::range_value_t<Out_r>, integral_t<std::ranges::range_value_t<Sample_r>, std::ranges::range_value_t<Axis_r>>>
+void cumulative_trapezoid(const Sample_r& p_samples, const Axis_r& p_axis, Out_r&& p_out, uintptr_t p_grain = default_grain, thread_pool& p_pool = _p::default_thread_pool())
+{
+	using out_t = std::ranges::range_value_t<Out_r>;
+
+	const auto* const t_samples	= std::ranges::data(p_samples);
+	const auto* const t_axis	= std::ranges::data(p_axis);
+	out_t* const t_out			= std::ranges::data(p_out);
+	const uintptr_t t_count		= std::min<uintptr_t>({std::ranges::size(p_samples), std::ranges::size(p_axis), std::ranges::size(p_out)});
+	if(t_count == 0) return;
+
+	//every output first receives the area of its own trapezoid, then the areas are accumulated in place
+	const _p::chunking t_chunks = _p::make_chunking(t_count, p_grain);
+	auto t_areas = [&](uintptr_t p_chunk)
+	{
+		const uintptr_t t_end = t_chunks.end(p_chunk);
+		for(uintptr_t i = std::max<uintptr_t>(t_chunks.begin(p_chunk), 1); i < t_end; ++i)
+		{
+			t_out[i] = out_t{(t_samples[i] + t_samples[i - 1]) * (t_axis[i] - t_axis[i - 1]) * 0.5};
+		}
+	};
+	_p::for_each_chunk(p_pool, t_chunks.chunks, t_areas);
+	t_out[0] = out_t{0};
+
+	_p::cumulative_sum<true>(t_out, t_out, t_count, p_grain, p_pool);
+}
+
+/// \brief Cumulative trapezoid integration of p_samples taken at a constant step p_step
+template<std::ranges::contiguous_range Sample_r, typename Step_t, std::ranges::contiguous_range Out_r> requires
+	std::is_same_v<std::ranges::range_value_t<Out_r>, integral_t<std::ranges::range_value_t<Sample_r>, Step_t>>
+void cumulative_trapezoid(const Sample_r& p_samples, const Step_t& p_step, Out_r&& p_out, uintptr_t p_grain = default_grain, thread_pool& p_pool = _p::default_thread_pool())
+{
+	using out_t = std::ranges::range_value_t<Out_r>;
+
+	const auto* const t_samples	= std::ranges::data(p_samples);
+	out_t* const t_out			= std::ranges::data(p_out);
+	const uintptr_t t_count		= std::min<uintptr_t>(std::ranges::size(p_samples), std::ranges::size(p_out));
+	if(t_count == 0) return;
+
+	const _p::chunking t_chunks = _p::make_chunking(t_count, p_grain);
+	const auto t_half_step = p_step * 0.5;
+	auto t_areas = [&](uintptr_t p_chunk)
+	{
+		const uintptr_t t_end = t_chunks.end(p_chunk);
+		for(uintptr_t i = std::max<uintptr_t>(t_chunks.begin(p_chunk), 1); i < t_end; ++i)
+		{
+			t_out[i] = out_t{(t_samples[i] + t_samples[i - 1]) * t_half_step};
+		}
+	};
+	_p::for_each_chunk(p_pool, t_chunks.chunks, t_areas);
+	t_out[0] = out_t{0};
+
+	_p::cumulative_sum<true>(t_out, t_out, t_count, p_grain, p_pool);
+}
+
+} //namespace unit::parallel
@@ -0,0 +1,241 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "unit_descriptor.hpp"
+
+namespace unit
+{
+
+namespace _p
+{
+	//---- Column kernels ----
+	//plain loops over contiguous memory, units are resolved before any of these is called
+
+	template<c_ValidFP Type>
+	inline void column_affine(Type* p_values, uintptr_t p_size, Type p_scale, Type p_shift)
+	{
+		for(uintptr_t i = 0; i < p_size; ++i)
+		{
+			p_values[i] = p_values[i] * p_scale + p_shift;
+		}
+	}
+
+	template<c_ValidFP Type>
+	inline void column_add(Type* p_out, const Type* p_left, const Type* p_right, uintptr_t p_size, Type p_scale)
+	{
+		for(uintptr_t i = 0; i < p_size; ++i)
+		{
+			p_out[i] = p_left[i] + p_right[i] * p_scale;
+		}
+	}
+
+	template<c_ValidFP Type>
+	inline void column_subtract(Type* p_out, const Type* p_left, const Type* p_right, uintptr_t p_size, Type p_scale)
+	{
+		for(uintptr_t i = 0; i < p_size; ++i)
+		{
+			p_out[i] = p_left[i] - p_right[i] * p_scale;
+		}
+	}
+
+	template<c_ValidFP Type>
+	inline void column_multiply(Type* p_out, const Type* p_left, const Type* p_right, uintptr_t p_size)
+	{
+		for(uintptr_t i = 0; i < p_size; ++i)
+		{
+			p_out[i] = p_left[i] * p_right[i];
+		}
+	}
+
+	template<c_ValidFP Type>
+	inline void column_divide(Type* p_out, const Type* p_left, const Type* p_right, uintptr_t p_size)
+	{
+		for(uintptr_t i = 0; i < p_size; ++i)
+		{
+			p_out[i] = p_left[i] / p_right[i];
+		}
+	}
+} //namespace _p
+
+
+/// \brief Values that all share one unit only known at runtime
+/// \details The unit is stored once for the whole column, values are stored contiguously.
+///	Operations between columns check units once, and then run a loop over the raw values.
+template<_p::c_ValidFP Type>
+class dynamic_column
+{
+public:
+	using value_t = Type;
+
+public:
+	inline dynamic_column() = default;
+
+	inline explicit dynamic_column(const unit_descriptor& p_descriptor)
+		: m_descriptor{p_descriptor}
+	{}
+
+	inline dynamic_column(const unit_descriptor& p_descriptor, std::vector<value_t> p_values)
+		: m_descriptor{p_descriptor}
+		, m_values{std::move(p_values)}
+	{}
+
+	inline const unit_descriptor& descriptor() const { return m_descriptor; }
+	inline uintptr_t size() const { return m_values.size(); }
+	inline bool empty() const { return m_values.empty(); }
+
+	inline std::span<value_t> values() { return m_values; }
+	inline std::span<const value_t> values() const { return m_values; }
+
+	inline value_t operator [] (uintptr_t p_index) const { return m_values[p_index]; }
+
+	inline void reserve(uintptr_t p_size) { m_values.reserve(p_size); }
+	inline void push_back(value_t p_value) { m_values.push_back(p_value); }
+
+	/// \brief Converts every value in place to a compatible unit
+	/// \return false if units are not compatible, the column is left unchanged
+	inline bool convert_to(const unit_descriptor& p_descriptor)
+	{
+		const std::optional<affine_conversion> t_conversion = make_conversion(m_descriptor, p_descriptor);
+		if(!t_conversion)
+		{
+			return false;
+		}
+		if(t_conversion->scale != 1.0 || t_conversion->shift != 0.0)
+		{
+			_p::column_affine(m_values.data(), size(), static_cast<value_t>(t_conversion->scale), static_cast<value_t>(t_conversion->shift));
+		}
+		m_descriptor = p_descriptor;
+		return true;
+	}
+
+	/// \brief Element wise sum, expressed in the unit of this column
+	/// \return std::nullopt if sizes differ, units are not compatible, or p_other has an offset
+	inline std::optional<dynamic_column> add(const dynamic_column& p_other) const
+	{
+		const std::optional<value_t> t_scale = additive_scale(p_other);
+		if(!t_scale)
+		{
+			return std::nullopt;
+		}
+		dynamic_column t_result{m_descriptor, std::vector<value_t>(size())};
+		_p::column_add(t_result.m_values.data(), m_values.data(), p_other.m_values.data(), size(), *t_scale);
+		return t_result;
+	}
+
+	/// \brief Element wise difference, expressed in the unit of this column
+	/// \return std::nullopt if sizes differ, units are not compatible, or p_other has an offset
+	inline std::optional<dynamic_column> subtract(const dynamic_column& p_other) const
+	{
+		const std::optional<value_t> t_scale = additive_scale(p_other);
+		if(!t_scale)
+		{
+			return std::nullopt;
+		}
+		dynamic_column t_result{m_descriptor, std::vector<value_t>(size())};
+		_p::column_subtract(t_result.m_values.data(), m_values.data(), p_other.m_values.data(), size(), *t_scale);
+		return t_result;
+	}
+
+	/// \brief Element wise product
+	/// \return std::nullopt if sizes differ or either column has an offset
+	inline std::optional<dynamic_column> multiply(const dynamic_column& p_other) const
+	{
+		if(size() != p_other.size())
+		{
+			return std::nullopt;
+		}
+		const std::optional<unit_descriptor> t_descriptor = m_descriptor.multiply(p_other.m_descriptor);
+		if(!t_descriptor)
+		{
+			return std::nullopt;
+		}
+		dynamic_column t_result{*t_descriptor, std::vector<value_t>(size())};
+		_p::column_multiply(t_result.m_values.data(), m_values.data(), p_other.m_values.data(), size());
+		return t_result;
+	}
+
+	/// \brief Element wise quotient
+	/// \return std::nullopt if sizes differ or either column has an offset
+	inline std::optional<dynamic_column> divide(const dynamic_column& p_other) const
+	{
+		if(size() != p_other.size())
+		{
+			return std::nullopt;
+		}
+		const std::optional<unit_descriptor> t_descriptor = m_descriptor.divide(p_other.m_descriptor);
+		if(!t_descriptor)
+		{
+			return std::nullopt;
+		}
+		dynamic_column t_result{*t_descriptor, std::vector<value_t>(size())};
+		_p::column_divide(t_result.m_values.data(), m_values.data(), p_other.m_values.data(), size());
+		return t_result;
+	}
+
+	/// \brief Copies the values out as a static unit, converting them if necessary
+	/// \return false if units are not compatible or p_out does not have the same size as the column
+	template<typename Unit_t> requires (_p::c_unit<Unit_t> || _p::c_offset_unit<Unit_t>)
+	inline bool copy_to(std::span<Unit_t> p_out) const
+	{
+		using out_value_t = typename Unit_t::value_t;
+
+		const std::optional<affine_conversion> t_conversion = make_conversion(m_descriptor, unit_descriptor_v<Unit_t>);
+		if(!t_conversion || p_out.size() != size())
+		{
+			return false;
+		}
+
+		for(uintptr_t i = 0; i < size(); ++i)
+		{
+			p_out[i] = Unit_t{t_conversion->apply(static_cast<out_value_t>(m_values[i]))};
+		}
+		return true;
+	}
+
+private:
+	/// \brief factor that brings values of p_other to the unit of this column, as a difference
+	inline std::optional<value_t> additive_scale(const dynamic_column& p_other) const
+	{
+		if(size() != p_other.size() || !m_descriptor.compatible(p_other.m_descriptor) || p_other.m_descriptor.has_offset())
+		{
+			return std::nullopt;
+		}
+		return static_cast<value_t>(p_other.m_descriptor.gauge() / m_descriptor.gauge());
+	}
+
+private:
+	unit_descriptor			m_descriptor;
+	std::vector<value_t>	m_values;
+};
+
+} //namespace unit
@@ -0,0 +1,159 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <optional>
+
+#include "_p/unit_type.hpp"
+#include "_p/dynamic_signature.hpp"
+
+namespace unit
+{
+
+/// \brief A unit only known at runtime
+/// \details Holds a value, the dimension signature of its unit, and the scale of the unit relative to SI.
+///	The value in SI units is value() * scale(), see standard_value().
+/// \note Checking compatibility, multiplying and dividing only touch the packed signature word.
+template<_p::c_ValidFP Type>
+class dynamic_unit
+{
+public:
+	using value_t = Type;
+
+public:
+	inline constexpr dynamic_unit(): m_value{}, m_signature{}, m_scale{1} {}
+	inline constexpr dynamic_unit(const dynamic_unit&) = default;
+
+	inline constexpr dynamic_unit(value_t p_value, _p::dynamic_signature p_signature, value_t p_scale = 1)
+		: m_value{p_value}
+		, m_signature{p_signature}
+		, m_scale{p_scale}
+	{}
+
+	template<_p::c_ValidFP Type2, _p::c_dynamic_unit_pack Pack2>
+	inline constexpr dynamic_unit(const _p::Unit<Type2, Pack2>& p_other)
+		: m_value{static_cast<value_t>(p_other.value())}
+		, m_signature{_p::dynamic_signature_v<Pack2>}
+		, m_scale{static_cast<value_t>(Pack2::gauge)}
+	{}
+
+	//---- Operators ----
+	inline dynamic_unit& operator = (const dynamic_unit&) = default;
+
+	inline constexpr dynamic_unit operator * (const dynamic_unit& p_other) const
+	{
+		return dynamic_unit{m_value * p_other.m_value, m_signature * p_other.m_signature, m_scale * p_other.m_scale};
+	}
+
+	inline constexpr dynamic_unit operator / (const dynamic_unit& p_other) const
+	{
+		return dynamic_unit{m_value / p_other.m_value, m_signature / p_other.m_signature, m_scale / p_other.m_scale};
+	}
+
+	template<_p::c_arithmethic Type2>
+	inline constexpr dynamic_unit operator * (Type2 p_val) const
+	{
+		return dynamic_unit{static_cast<value_t>(m_value * p_val), m_signature, m_scale};
+	}
+
+	template<_p::c_arithmethic Type2>
+	inline constexpr dynamic_unit operator / (Type2 p_val) const
+	{
+		return dynamic_unit{static_cast<value_t>(m_value / p_val), m_signature, m_scale};
+	}
+
+	inline constexpr dynamic_unit operator -() const { return dynamic_unit{-m_value, m_signature, m_scale}; }
+
+	//---- Checked operations ----
+	inline constexpr bool compatible(const dynamic_unit& p_other) const
+	{
+		return m_signature == p_other.m_signature;
+	}
+
+	/// \brief Sum expressed in the unit of this
+	/// \return std::nullopt if units are not compatible
+	inline constexpr std::optional<dynamic_unit> add(const dynamic_unit& p_other) const
+	{
+		if(!compatible(p_other))
+		{
+			return std::nullopt;
+		}
+		return dynamic_unit{m_value + p_other.value_in(m_scale), m_signature, m_scale};
+	}
+
+	/// \brief Difference expressed in the unit of this
+	/// \return std::nullopt if units are not compatible
+	inline constexpr std::optional<dynamic_unit> subtract(const dynamic_unit& p_other) const
+	{
+		if(!compatible(p_other))
+		{
+			return std::nullopt;
+		}
+		return dynamic_unit{m_value - p_other.value_in(m_scale), m_signature, m_scale};
+	}
+
+	/// \brief Converts to a static unit
+	/// \return std::nullopt if the dimensions do not match
+	template<_p::c_unit Unit_t> requires _p::c_dynamic_unit_pack<typename Unit_t::unit_pack>
+	inline constexpr std::optional<Unit_t> to_unit() const
+	{
+		using unit_pack = typename Unit_t::unit_pack;
+		if(m_signature != _p::dynamic_signature_v<unit_pack>)
+		{
+			return std::nullopt;
+		}
+		return Unit_t{static_cast<typename Unit_t::value_t>(value_in(static_cast<value_t>(unit_pack::gauge)))};
+	}
+
+	inline constexpr value_t value() const { return m_value; }
+	inline constexpr value_t scale() const { return m_scale; }
+	inline constexpr value_t standard_value() const { return m_value * m_scale; }
+	inline constexpr _p::dynamic_signature signature() const { return m_signature; }
+
+private:
+	/// \brief value expressed in a unit with a different scale
+	inline constexpr value_t value_in(value_t p_scale) const
+	{
+		if(p_scale == m_scale)
+		{
+			return m_value;
+		}
+		return m_value * (m_scale / p_scale);
+	}
+
+private:
+	value_t					m_value;
+	_p::dynamic_signature	m_signature;
+	value_t					m_scale;
+};
+
+template <_p::c_arithmethic valueL_t, _p::c_ValidFP valueR_t>
+constexpr dynamic_unit<valueR_t> operator * (valueL_t p_left, const dynamic_unit<valueR_t>& p_right)
+{
+	return p_right * p_left;
+}
+
+} //namespace unit
@@ -0,0 +1,154 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include "unit.hpp"
+
+/// \brief Unit aliases with a dedicated instantiation, every entry must name a distinct unit type
+#define UNIT_UNIT_ALIASES(X) \
+	X(metre_per_second_squared_t) \
+	X(foot_per_second_squared_t) \
+	X(radian_t) \
+	X(grad_t) \
+	X(degree_t) \
+	X(arc_minute_t) \
+	X(arc_second_t) \
+	X(turn_t) \
+	X(radian_per_second_square_t) \
+	X(turn_per_second_square_t) \
+	X(radians_per_second_t) \
+	X(rotations_per_minute_t) \
+	X(square_metre_t) \
+	X(square_foot_t) \
+	X(hectare_t) \
+	X(acre_t) \
+	X(square_mile_t) \
+	X(square_kilo_metre_t) \
+	X(coloumb_t) \
+	X(amper_hour_t) \
+	X(milli_amper_hour_t) \
+	X(kilogram_per_cubic_metre_t) \
+	X(pound_av_per_cubic_feet_t) \
+	X(bit_t) \
+	X(byte_t) \
+	X(doublet_t) \
+	X(quadlet_t) \
+	X(octlet_t) \
+	X(kibibyte_t) \
+	X(mebibyte_t) \
+	X(gibibyte_t) \
+	X(tebibyte_t) \
+	X(pebibyte_t) \
+	X(ampere_t) \
+	X(volt_t) \
+	X(ohm_t) \
+	X(joule_t) \
+	X(watt_hour_t) \
+	X(kilo_watt_hour_t) \
+	X(kilogram_per_second_t) \
+	X(pound_av_per_second_t) \
+	X(cubic_metre_per_second_t) \
+	X(cubic_foot_per_second_t) \
+	X(newton_t) \
+	X(kilogram_force_t) \
+	X(pound_av_force_t) \
+	X(poundal_t) \
+	X(metre_t) \
+	X(foot_t) \
+	X(inch_t) \
+	X(yard_t) \
+	X(mile_t) \
+	X(nautical_mile_t) \
+	X(light_second_t) \
+	X(light_year_t) \
+	X(nano_metre_t) \
+	X(micro_metre_t) \
+	X(milli_metre_t) \
+	X(centi_metre_t) \
+	X(kilo_metre_t) \
+	X(candela_t) \
+	X(kilogram_t) \
+	X(gram_t) \
+	X(pound_av_t) \
+	X(ounce_av_t) \
+	X(tonne_t) \
+	X(watt_t) \
+	X(pascal_t) \
+	X(kilopascal_t) \
+	X(bar_t) \
+	X(pound_av_force_per_square_inch_t) \
+	X(inch_mercury32_t) \
+	X(inch_mercury60_t) \
+	X(atmosphere_t) \
+	X(poundal_per_square_foot_t) \
+	X(kelvin_t) \
+	X(rankine_t) \
+	X(second_t) \
+	X(minute_t) \
+	X(hour_t) \
+	X(nano_second_t) \
+	X(micro_second_t) \
+	X(milli_second_t) \
+	X(hertz_t) \
+	X(newton_metre_t) \
+	X(pound_av_force_foot_t) \
+	X(metre_per_second_t) \
+	X(foot_per_second_t) \
+	X(kilometre_per_hour_t) \
+	X(mile_per_hour_t) \
+	X(knot_t) \
+	X(cubic_metre_t) \
+	X(litre_t) \
+	X(cubic_foot_t) \
+	X(gallon_t) \
+	X(pint_t)
+
+/// \brief Offset unit aliases with a dedicated instantiation
+#define UNIT_OFFSET_ALIASES(X) \
+	X(celcius_t) \
+	X(fahrenheit_t)
+
+/// \brief Instantiates (or with Prefix = extern, declares the instantiation of) an alias for every supported value type
+#define UNIT_INSTANTIATE_UNIT(Prefix, Alias) \
+	Prefix template class ::unit::_p::Unit<float,		typename ::unit::Alias<float>::unit_pack>; \
+	Prefix template class ::unit::_p::Unit<double,		typename ::unit::Alias<double>::unit_pack>; \
+	Prefix template class ::unit::_p::Unit<long double,	typename ::unit::Alias<long double>::unit_pack>;
+
+#define UNIT_INSTANTIATE_OFFSET_UNIT(Prefix, Alias) \
+	Prefix template class ::unit::_p::Offset_Unit<float,		typename ::unit::Alias<float>::prop_t>; \
+	Prefix template class ::unit::_p::Offset_Unit<double,		typename ::unit::Alias<double>::prop_t>; \
+	Prefix template class ::unit::_p::Offset_Unit<long double,	typename ::unit::Alias<long double>::prop_t>;
+
+#define UNIT_EXTERN_UNIT(Alias)			UNIT_INSTANTIATE_UNIT(extern, Alias)
+#define UNIT_EXTERN_OFFSET_UNIT(Alias)	UNIT_INSTANTIATE_OFFSET_UNIT(extern, Alias)
+
+/// \note Only the class members are covered, operators with a deduced return type (ex. metric_multiply, metric_divide)
+///	and member templates (ex. converting constructors) can not be suppressed and are still instantiated where used.
+UNIT_UNIT_ALIASES(UNIT_EXTERN_UNIT)
+UNIT_OFFSET_ALIASES(UNIT_EXTERN_OFFSET_UNIT)
+
+#undef UNIT_EXTERN_UNIT
+#undef UNIT_EXTERN_OFFSET_UNIT
@@ -0,0 +1,55 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+/// \brief Declares the unit types and aliases, without the operators and conversions.
+/// \note Enough to name unit types in interfaces, include unit.hpp (or the alias headers) to use them.
+
+#include "_p/unit_fwd.hpp"
+
+#include "fwd/alias_acceleration.hpp"
+#include "fwd/alias_angle.hpp"
+#include "fwd/alias_angular_acceleration.hpp"
+#include "fwd/alias_angular_velocity.hpp"
+#include "fwd/alias_area.hpp"
+#include "fwd/alias_charge.hpp"
+#include "fwd/alias_density.hpp"
+#include "fwd/alias_digital.hpp"
+#include "fwd/alias_electrical.hpp"
+#include "fwd/alias_energy.hpp"
+#include "fwd/alias_flow_mass.hpp"
+#include "fwd/alias_flow_volume.hpp"
+#include "fwd/alias_force.hpp"
+#include "fwd/alias_lenght.hpp"
+#include "fwd/alias_luminosity.hpp"
+#include "fwd/alias_mass.hpp"
+#include "fwd/alias_power.hpp"
+#include "fwd/alias_pressure.hpp"
+#include "fwd/alias_temperature.hpp"
+#include "fwd/alias_time.hpp"
+#include "fwd/alias_torque.hpp"
+#include "fwd/alias_velocity.hpp"
+#include "fwd/alias_volume.hpp"
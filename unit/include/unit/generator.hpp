@@ -0,0 +1,228 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <algorithm>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "_p/unit_type.hpp"
+#include "_p/offset_unit.hpp"
+
+namespace unit
+{
+
+/// \brief Lazy sequence of chunks of units produced by a coroutine
+/// \note A chunk is only valid until the generator is resumed again.
+///		Exceptions escaping the coroutine terminate the program.
+template<typename Unit_t>
+	requires (_p::c_unit<Unit_t> || _p::c_offset_unit<Unit_t>)
+class generator
+{
+public:
+	using unit_t	= Unit_t;
+	using chunk_t	= std::span<const Unit_t>;
+
+	struct promise_type
+	{
+		chunk_t m_chunk;
+
+		inline generator get_return_object() { return generator{handle_t::from_promise(*this)}; }
+		inline std::suspend_always initial_suspend() noexcept { return {}; }
+		inline std::suspend_always final_suspend() noexcept { return {}; }
+		inline std::suspend_always yield_value(chunk_t p_chunk) noexcept
+		{
+			m_chunk = p_chunk;
+			return {};
+		}
+		inline void return_void() noexcept {}
+		inline void unhandled_exception() noexcept { std::terminate(); }
+	};
+
+	using handle_t = std::coroutine_handle<promise_type>;
+
+	class iterator
+	{
+	public:
+		using iterator_category	= std::input_iterator_tag;
+		using difference_type	= std::ptrdiff_t;
+		using value_type		= chunk_t;
+
+		iterator() = default;
+		inline explicit iterator(generator& p_generator): m_generator{&p_generator} {}
+
+		inline chunk_t operator * () const { return m_generator->chunk(); }
+		inline iterator& operator ++ ()
+		{
+			if(!m_generator->next()) m_generator = nullptr;
+			return *this;
+		}
+		inline void operator ++ (int) { ++*this; }
+		inline bool operator == (std::default_sentinel_t) const { return m_generator == nullptr; }
+
+	private:
+		generator* m_generator = nullptr;
+	};
+
+public:
+	generator() = default;
+	generator(const generator&) = delete;
+	inline generator(generator&& p_other) noexcept: m_handle{std::exchange(p_other.m_handle, nullptr)} {}
+	inline ~generator() { if(m_handle) m_handle.destroy(); }
+
+	generator& operator = (const generator&) = delete;
+	inline generator& operator = (generator&& p_other) noexcept
+	{
+		if(this != &p_other)
+		{
+			if(m_handle) m_handle.destroy();
+			m_handle = std::exchange(p_other.m_handle, nullptr);
+		}
+		return *this;
+	}
+
+	/// \brief Resumes the producer until it yields the next chunk
+	/// \return false if the sequence is exhausted
+	inline bool next()
+	{
+		if(!m_handle || m_handle.done()) return false;
+		m_handle.resume();
+		return !m_handle.done();
+	}
+
+	inline chunk_t chunk() const { return m_handle.promise().m_chunk; }
+
+	inline iterator begin()
+	{
+		iterator t_it{*this};
+		++t_it;
+		return t_it;
+	}
+	inline std::default_sentinel_t end() const { return {}; }
+
+private:
+	inline explicit generator(handle_t p_handle): m_handle{p_handle} {}
+
+private:
+	handle_t m_handle = nullptr;
+};
+
+} //namespace unit
+
+
+namespace unit::stream
+{
+
+//======== ======== Stages ======== ========
+
+/// \brief Yields an existing contiguous sequence in chunks of at most p_chunk_size, without copying
+template<typename Unit_t>
+generator<Unit_t> source(std::span<const Unit_t> p_samples, uintptr_t p_chunk_size)
+{
+	if(p_chunk_size == 0) p_chunk_size = 1;
+	while(!p_samples.empty())
+	{
+		const uintptr_t t_count = std::min<uintptr_t>(p_chunk_size, p_samples.size());
+		co_yield p_samples.first(t_count);
+		p_samples = p_samples.subspan(t_count);
+	}
+}
+
+/// \brief Yields chunks filled by p_reader
+/// \param[in] p_reader - called with a buffer of p_chunk_size units, returns the number of units written to it, 0 ends the sequence
+template<typename Unit_t, typename Reader_t>
+	requires std::is_invocable_r_v<uintptr_t, Reader_t&, std::span<Unit_t>>
+generator<Unit_t> source(Reader_t p_reader, uintptr_t p_chunk_size)
+{
+	std::vector<Unit_t> t_buffer(p_chunk_size == 0 ? 1 : p_chunk_size);
+	while(true)
+	{
+		const uintptr_t t_count = p_reader(std::span<Unit_t>{t_buffer});
+		if(t_count == 0) co_return;
+		co_yield std::span<const Unit_t>{t_buffer.data(), std::min<uintptr_t>(t_count, t_buffer.size())};
+	}
+}
+
+/// \brief Converts every chunk of p_input to To_t
+template<typename To_t, typename From_t>
+	requires std::is_constructible_v<To_t, const From_t&>
+generator<To_t> convert(generator<From_t> p_input)
+{
+	std::vector<To_t> t_buffer;
+	for(const std::span<const From_t> t_chunk: p_input)
+	{
+		if(t_buffer.size() < t_chunk.size()) t_buffer.resize(t_chunk.size());
+		for(uintptr_t i = 0; i < t_chunk.size(); ++i)
+		{
+			t_buffer[i] = To_t{t_chunk[i]};
+		}
+		co_yield std::span<const To_t>{t_buffer.data(), t_chunk.size()};
+	}
+}
+
+/// \brief Only lets through the units for which p_predicate returns true
+/// \note Chunks that end up empty are not yielded
+template<typename Unit_t, typename Predicate_t>
+	requires std::is_invocable_r_v<bool, Predicate_t&, const Unit_t&>
+generator<Unit_t> filter(generator<Unit_t> p_input, Predicate_t p_predicate)
+{
+	std::vector<Unit_t> t_buffer;
+	for(const std::span<const Unit_t> t_chunk: p_input)
+	{
+		if(t_buffer.size() < t_chunk.size()) t_buffer.resize(t_chunk.size());
+		uintptr_t t_count = 0;
+		for(const Unit_t& t_unit: t_chunk)
+		{
+			if(p_predicate(t_unit))
+			{
+				t_buffer[t_count++] = t_unit;
+			}
+		}
+		if(t_count != 0)
+		{
+			co_yield std::span<const Unit_t>{t_buffer.data(), t_count};
+		}
+	}
+}
+
+/// \brief Drains p_input, passing every chunk to p_consumer
+template<typename Unit_t, typename Consumer_t>
+	requires std::is_invocable_v<Consumer_t&, std::span<const Unit_t>>
+void sink(generator<Unit_t> p_input, Consumer_t p_consumer)
+{
+	for(const std::span<const Unit_t> t_chunk: p_input)
+	{
+		p_consumer(t_chunk);
+	}
+}
+
+} //namespace unit::stream
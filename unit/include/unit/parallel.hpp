@@ -0,0 +1,383 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+#include "_p/thread_pool.hpp"
+#include "_p/unit_fwd.hpp"
+
+namespace unit::_p
+{
+
+/// \brief Splits a number of elements in chunks of a given grain size
+struct chunking
+{
+	uintptr_t count;
+	uintptr_t grain;
+	uintptr_t chunks;
+
+	inline constexpr uintptr_t begin(uintptr_t p_chunk) const { return p_chunk * grain; }
+	inline constexpr uintptr_t end(uintptr_t p_chunk) const { return std::min(count, (p_chunk + 1) * grain); }
+};
+
+inline constexpr chunking make_chunking(uintptr_t p_count, uintptr_t p_grain)
+{
+	if(p_grain == 0) p_grain = 1;
+	//keep the chunk indexes addressable by the work stealing ranges
+	const uintptr_t t_min_grain = p_count / chunk_range::max_chunks + 1;
+	if(p_grain < t_min_grain) p_grain = t_min_grain;
+
+	return chunking{p_count, p_grain, (p_count + p_grain - 1) / p_grain};
+}
+
+
+//======== ======== Sum scan kernels ======== ========
+
+template<typename T>
+inline constexpr auto raw_value(const T& p_value)
+{
+	if constexpr(c_unit<T>)
+	{
+		return p_value.value();
+	}
+	else
+	{
+		return p_value;
+	}
+}
+
+/// \brief Number of elements scanned as a block held in registers
+inline constexpr uintptr_t scan_lanes = 8;
+
+/// \brief Scans [p_begin, p_end) of p_in into p_out, starting from p_carry
+/// \note Blocks of scan_lanes elements are scanned in registers with log2(scan_lanes) shifted adds,
+///		a form the compiler can vectorize, the carry is then added to the whole block.
+///		The association order differs from a sequential sum, results may differ in the last bits.
+/// \return The carry after the last element
+template<bool Inclusive, typename Unit_t, typename Value_t>
+inline Value_t scan_kernel(const Unit_t* p_in, Unit_t* p_out, uintptr_t p_begin, uintptr_t p_end, Value_t p_carry)
+{
+	uintptr_t i = p_begin;
+	for(; i + scan_lanes <= p_end; i += scan_lanes)
+	{
+		Value_t t_block[scan_lanes];
+		for(uintptr_t l = 0; l < scan_lanes; ++l)
+		{
+			t_block[l] = raw_value(p_in[i + l]);
+		}
+
+		Value_t t_scan[scan_lanes];
+		for(uintptr_t l = 0; l < scan_lanes; ++l)
+		{
+			t_scan[l] = t_block[l];
+		}
+		for(uintptr_t t_shift = 1; t_shift < scan_lanes; t_shift <<= 1)
+		{
+			Value_t t_shifted[scan_lanes];
+			for(uintptr_t l = 0; l < scan_lanes; ++l)
+			{
+				t_shifted[l] = l < t_shift ? Value_t{0} : t_scan[l - t_shift];
+			}
+			for(uintptr_t l = 0; l < scan_lanes; ++l)
+			{
+				t_scan[l] += t_shifted[l];
+			}
+		}
+
+		for(uintptr_t l = 0; l < scan_lanes; ++l)
+		{
+			if constexpr(Inclusive)
+			{
+				p_out[i + l] = Unit_t{p_carry + t_scan[l]};
+			}
+			else
+			{
+				p_out[i + l] = Unit_t{p_carry + (t_scan[l] - t_block[l])};
+			}
+		}
+		p_carry += t_scan[scan_lanes - 1];
+	}
+
+	for(; i < p_end; ++i)
+	{
+		const Value_t t_value = raw_value(p_in[i]);
+		if constexpr(Inclusive)
+		{
+			p_carry += t_value;
+			p_out[i] = Unit_t{p_carry};
+		}
+		else
+		{
+			p_out[i] = Unit_t{p_carry};
+			p_carry += t_value;
+		}
+	}
+	return p_carry;
+}
+
+/// \brief Sum of [p_begin, p_end) using independent accumulators
+template<typename Unit_t, typename Value_t>
+inline Value_t sum_kernel(const Unit_t* p_in, uintptr_t p_begin, uintptr_t p_end)
+{
+	Value_t t_sum[scan_lanes] = {};
+	uintptr_t i = p_begin;
+	for(; i + scan_lanes <= p_end; i += scan_lanes)
+	{
+		for(uintptr_t l = 0; l < scan_lanes; ++l)
+		{
+			t_sum[l] += raw_value(p_in[i + l]);
+		}
+	}
+	for(; i < p_end; ++i)
+	{
+		t_sum[0] += raw_value(p_in[i]);
+	}
+
+	Value_t t_total{0};
+	for(uintptr_t l = 0; l < scan_lanes; ++l)
+	{
+		t_total += t_sum[l];
+	}
+	return t_total;
+}
+
+/// \brief Multi-threaded cumulative sum, chunk totals are computed in parallel, carried serially, then every chunk is scanned in parallel
+template<bool Inclusive, typename Unit_t>
+void cumulative_sum(const Unit_t* p_in, Unit_t* p_out, uintptr_t p_count, uintptr_t p_grain, thread_pool& p_pool)
+{
+	using value_t = decltype(raw_value(std::declval<const Unit_t&>()));
+
+	const chunking t_chunks = make_chunking(p_count, p_grain);
+	if(t_chunks.chunks == 0) return;
+
+	if(t_chunks.chunks == 1 || p_pool.size() == 1)
+	{
+		scan_kernel<Inclusive>(p_in, p_out, 0, p_count, value_t{0});
+		return;
+	}
+
+	std::vector<value_t> t_carry(t_chunks.chunks, value_t{0});
+
+	auto t_totals = [&](uintptr_t p_chunk)
+	{
+		if(p_chunk + 1 == t_chunks.chunks) return;
+		t_carry[p_chunk + 1] = sum_kernel<Unit_t, value_t>(p_in, t_chunks.begin(p_chunk), t_chunks.end(p_chunk));
+	};
+	for_each_chunk(p_pool, t_chunks.chunks, t_totals);
+
+	for(uintptr_t i = 2; i < t_chunks.chunks; ++i)
+	{
+		t_carry[i] += t_carry[i - 1];
+	}
+
+	auto t_body = [&](uintptr_t p_chunk)
+	{
+		scan_kernel<Inclusive>(p_in, p_out, t_chunks.begin(p_chunk), t_chunks.end(p_chunk), t_carry[p_chunk]);
+	};
+	for_each_chunk(p_pool, t_chunks.chunks, t_body);
+}
+
+template<typename Op_t, typename Value_t>
+inline constexpr bool is_plus_v = std::is_same_v<Op_t, std::plus<>> || std::is_same_v<Op_t, std::plus<Value_t>>;
+
+/// \brief Scans that can go through cumulative_sum, sums of units or of arithmetic values
+template<typename In_r, typename Out_r, typename Op_t>
+concept c_sum_scan =
+	std::is_same_v<std::ranges::range_value_t<In_r>, std::ranges::range_value_t<Out_r>> &&
+	(c_unit<std::ranges::range_value_t<In_r>> || std::is_arithmetic_v<std::ranges::range_value_t<In_r>>) &&
+	is_plus_v<Op_t, std::ranges::range_value_t<In_r>>;
+
+} //namespace unit::_p
+
+
+namespace unit::parallel
+{
+
+using thread_pool = _p::thread_pool;
+
+/// \brief Default number of elements processed as a single unit of work
+inline constexpr uintptr_t default_grain = 16384;
+
+
+/// \brief Converts every element of p_in into the unit type of p_out
+/// \note Only the length common to both ranges is processed
+template<std::ranges::contiguous_range In_r, std::ranges::contiguous_range Out_r> requires
+	std::is_constructible_v<std::ranges::range_value_t<Out_r>, std::ranges::range_reference_t<const In_r>>
+void convert(const In_r& p_in, Out_r&& p_out, uintptr_t p_grain = default_grain, thread_pool& p_pool = _p::default_thread_pool())
+{
+	using out_t = std::ranges::range_value_t<Out_r>;
+
+	const auto* const t_in	= std::ranges::data(p_in);
+	out_t* const t_out		= std::ranges::data(p_out);
+	const _p::chunking t_chunks = _p::make_chunking(
+		std::min<uintptr_t>(std::ranges::size(p_in), std::ranges::size(p_out)), p_grain);
+
+	auto t_body = [&](uintptr_t p_chunk)
+	{
+		const uintptr_t t_end = t_chunks.end(p_chunk);
+		for(uintptr_t i = t_chunks.begin(p_chunk); i < t_end; ++i)
+		{
+			t_out[i] = out_t{t_in[i]};
+		}
+	};
+	_p::for_each_chunk(p_pool, t_chunks.chunks, t_body);
+}
+
+/// \brief Stores p_function(p_in[i]) in p_out[i]
+/// \note Only the length common to both ranges is processed
+template<std::ranges::contiguous_range In_r, std::ranges::contiguous_range Out_r, typename Function_t>
+void transform(const In_r& p_in, Out_r&& p_out, Function_t p_function, uintptr_t p_grain = default_grain, thread_pool& p_pool = _p::default_thread_pool())
+{
+	const auto* const t_in	= std::ranges::data(p_in);
+	auto* const t_out		= std::ranges::data(p_out);
+	const _p::chunking t_chunks = _p::make_chunking(
+		std::min<uintptr_t>(std::ranges::size(p_in), std::ranges::size(p_out)), p_grain);
+
+	auto t_body = [&](uintptr_t p_chunk)
+	{
+		const uintptr_t t_end = t_chunks.end(p_chunk);
+		for(uintptr_t i = t_chunks.begin(p_chunk); i < t_end; ++i)
+		{
+			t_out[i] = p_function(t_in[i]);
+		}
+	};
+	_p::for_each_chunk(p_pool, t_chunks.chunks, t_body);
+}
+
+/// \brief Folds all elements of p_in with p_op, starting from p_init
+/// \note Every chunk is folded separately and the partial results are then folded in order,
+///		the result is therefore deterministic for a given grain but p_op must be associative.
+template<std::ranges::contiguous_range In_r, typename Init_t, typename Op_t = std::plus<>>
+auto reduce(const In_r& p_in, Init_t p_init, Op_t p_op = {}, uintptr_t p_grain = default_grain, thread_pool& p_pool = _p::default_thread_pool())
+{
+	using result_t = std::remove_cvref_t<std::invoke_result_t<Op_t&, const Init_t&, std::ranges::range_reference_t<const In_r>>>;
+
+	const auto* const t_in = std::ranges::data(p_in);
+	const _p::chunking t_chunks = _p::make_chunking(std::ranges::size(p_in), p_grain);
+
+	std::vector<std::optional<result_t>> t_partial(t_chunks.chunks);
+
+	auto t_body = [&](uintptr_t p_chunk)
+	{
+		const uintptr_t t_begin	= t_chunks.begin(p_chunk);
+		const uintptr_t t_end	= t_chunks.end(p_chunk);
+		result_t t_accumulated{t_in[t_begin]};
+		for(uintptr_t i = t_begin + 1; i < t_end; ++i)
+		{
+			t_accumulated = p_op(t_accumulated, t_in[i]);
+		}
+		t_partial[p_chunk].emplace(t_accumulated);
+	};
+	_p::for_each_chunk(p_pool, t_chunks.chunks, t_body);
+
+	result_t t_result{p_init};
+	for(const std::optional<result_t>& t_value: t_partial)
+	{
+		t_result = p_op(t_result, *t_value);
+	}
+	return t_result;
+}
+
+/// \brief Inclusive scan, p_out[i] = p_in[0] op p_in[1] op ... op p_in[i]
+/// \note Runs in 2 passes, chunk totals are computed in parallel, carried serially, and then each chunk is scanned in parallel.
+///		Only the length common to both ranges is processed, p_in and p_out may be the same range.
+///		Sums (std::plus) of units or arithmetic values go through a vectorizable kernel,
+///		its association order differs from a sequential sum and results may differ in the last bits.
+template<std::ranges::contiguous_range In_r, std::ranges::contiguous_range Out_r, typename Op_t = std::plus<>>
+void scan(const In_r& p_in, Out_r&& p_out, Op_t p_op = {}, uintptr_t p_grain = default_grain, thread_pool& p_pool = _p::default_thread_pool())
+{
+	using out_t = std::ranges::range_value_t<Out_r>;
+
+	const auto* const t_in	= std::ranges::data(p_in);
+	out_t* const t_out		= std::ranges::data(p_out);
+	const uintptr_t t_count	= std::min<uintptr_t>(std::ranges::size(p_in), std::ranges::size(p_out));
+
+	if constexpr(_p::c_sum_scan<In_r, Out_r, Op_t>)
+	{
+		_p::cumulative_sum<true>(t_in, t_out, t_count, p_grain, p_pool);
+		return;
+	}
+
+	const _p::chunking t_chunks = _p::make_chunking(t_count, p_grain);
+	if(t_chunks.chunks == 0) return;
+
+	std::vector<std::optional<out_t>> t_carry(t_chunks.chunks);
+
+	auto t_totals = [&](uintptr_t p_chunk)
+	{
+		//the last chunk does not feed anyone
+		if(p_chunk + 1 == t_chunks.chunks) return;
+
+		const uintptr_t t_begin	= t_chunks.begin(p_chunk);
+		const uintptr_t t_end	= t_chunks.end(p_chunk);
+		out_t t_accumulated{t_in[t_begin]};
+		for(uintptr_t i = t_begin + 1; i < t_end; ++i)
+		{
+			t_accumulated = p_op(t_accumulated, t_in[i]);
+		}
+		t_carry[p_chunk + 1].emplace(t_accumulated);
+	};
+	_p::for_each_chunk(p_pool, t_chunks.chunks, t_totals);
+
+	for(uintptr_t i = 2; i < t_chunks.chunks; ++i)
+	{
+		t_carry[i].emplace(p_op(*t_carry[i - 1], *t_carry[i]));
+	}
+
+	auto t_body = [&](uintptr_t p_chunk)
+	{
+		const uintptr_t t_begin	= t_chunks.begin(p_chunk);
+		const uintptr_t t_end	= t_chunks.end(p_chunk);
+		out_t t_accumulated = t_carry[p_chunk] ? out_t{p_op(*t_carry[p_chunk], t_in[t_begin])} : out_t{t_in[t_begin]};
+		t_out[t_begin] = t_accumulated;
+		for(uintptr_t i = t_begin + 1; i < t_end; ++i)
+		{
+			t_accumulated = p_op(t_accumulated, t_in[i]);
+			t_out[i] = t_accumulated;
+		}
+	};
+	_p::for_each_chunk(p_pool, t_chunks.chunks, t_body);
+}
+
+/// \brief Cumulative sum excluding the current element, p_out[0] = 0, p_out[i] = p_in[0] + ... + p_in[i - 1]
+/// \note Only the length common to both ranges is processed, p_in and p_out may be the same range.
+///		Results may differ in the last bits from a sequential sum, see scan.
+template<std::ranges::contiguous_range In_r, std::ranges::contiguous_range Out_r> requires
+	_p::c_sum_scan<In_r, Out_r, std::plus<>>
+void exclusive_scan(const In_r& p_in, Out_r&& p_out, uintptr_t p_grain = default_grain, thread_pool& p_pool = _p::default_thread_pool())
+{
+	_p::cumulative_sum<false>(std::ranges::data(p_in), std::ranges::data(p_out),
+		std::min<uintptr_t>(std::ranges::size(p_in), std::ranges::size(p_out)), p_grain, p_pool);
+}
+
+} //namespace unit::parallel
@@ -0,0 +1,380 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "_p/utils.hpp"
+#include "_p/unit_type.hpp"
+#include "_p/offset_unit.hpp"
+
+namespace unit::pipeline
+{
+
+/// \brief Fixed size block of units exchanged between stages
+template<typename Unit_t, uintptr_t ChunkSize>
+	requires (_p::c_unit<Unit_t> || _p::c_offset_unit<Unit_t>)
+struct chunk
+{
+	using unit_t = Unit_t;
+	static constexpr uintptr_t capacity = ChunkSize;
+
+	std::array<Unit_t, ChunkSize> m_data;
+	uintptr_t m_size = 0;
+
+	inline std::span<const Unit_t> span() const { return {m_data.data(), m_size}; }
+};
+
+
+/// \brief Bounded queue of chunks between exactly one producer stage and one consumer stage
+/// \note Chunks are preallocated and written/read in place, a full queue blocks the producer (backpressure).
+template<typename Unit_t, uintptr_t ChunkSize>
+class chunk_queue
+{
+public:
+	using chunk_t = chunk<Unit_t, ChunkSize>;
+
+public:
+	/// \param[in] p_capacity - maximum number of chunks in flight
+	inline explicit chunk_queue(uintptr_t p_capacity)
+		: m_slots(p_capacity == 0 ? 1 : p_capacity)
+	{}
+
+	chunk_queue(const chunk_queue&) = delete;
+	chunk_queue& operator = (const chunk_queue&) = delete;
+
+	//======== Producer ========
+	/// \brief Waits for a free chunk to fill
+	inline chunk_t& acquire_write()
+	{
+		std::unique_lock t_lock{m_mutex};
+		m_not_full.wait(t_lock, [this] { return m_count < m_slots.size(); });
+		chunk_t& t_chunk = m_slots[(m_head + m_count) % m_slots.size()];
+		t_chunk.m_size = 0;
+		return t_chunk;
+	}
+
+	/// \brief Publishes the chunk obtained from acquire_write()
+	inline void commit_write()
+	{
+		{
+			std::lock_guard t_lock{m_mutex};
+			++m_count;
+		}
+		m_not_empty.notify_one();
+	}
+
+	/// \brief Signals that no more chunks will be written
+	inline void close()
+	{
+		{
+			std::lock_guard t_lock{m_mutex};
+			m_closed = true;
+		}
+		m_not_empty.notify_one();
+	}
+
+	//======== Consumer ========
+	/// \brief Waits for the next chunk
+	/// \return nullptr once the queue is closed and drained
+	inline const chunk_t* acquire_read()
+	{
+		std::unique_lock t_lock{m_mutex};
+		m_not_empty.wait(t_lock, [this] { return m_count != 0 || m_closed; });
+		if(m_count == 0) return nullptr;
+		return &m_slots[m_head];
+	}
+
+	/// \brief Returns the chunk obtained from acquire_read() to the producer
+	inline void release_read()
+	{
+		{
+			std::lock_guard t_lock{m_mutex};
+			m_head = (m_head + 1) % m_slots.size();
+			--m_count;
+		}
+		m_not_full.notify_one();
+	}
+
+private:
+	std::vector<chunk_t>	m_slots;
+	std::mutex				m_mutex;
+	std::condition_variable	m_not_full;
+	std::condition_variable	m_not_empty;
+	uintptr_t				m_head		= 0;
+	uintptr_t				m_count		= 0;
+	bool					m_closed	= false;
+};
+
+
+//======== ======== Statistics ======== ========
+
+/// \brief Snapshot of the activity of a stage
+struct stage_stats
+{
+	uint64_t chunks;		//!< chunks processed
+	uint64_t items;			//!< units processed
+	uint64_t busy_ns;		//!< time spent processing
+	uint64_t blocked_ns;	//!< time spent waiting on queues
+	uint64_t max_chunk_ns;	//!< slowest single chunk
+
+	/// \brief Units processed per second of busy time
+	inline double throughput() const
+	{
+		return busy_ns == 0 ? 0.0 : static_cast<double>(items) * 1e9 / static_cast<double>(busy_ns);
+	}
+
+	/// \brief Average processing time per chunk
+	inline double mean_chunk_ns() const
+	{
+		return chunks == 0 ? 0.0 : static_cast<double>(busy_ns) / static_cast<double>(chunks);
+	}
+};
+
+/// \brief Counters updated by a running stage, may be read from any thread
+class alignas(_p::cache_line_size) stage_counters
+{
+public:
+	inline void add_chunk(uint64_t p_items, uint64_t p_busy_ns)
+	{
+		m_chunks.fetch_add(1, std::memory_order_relaxed);
+		m_items.fetch_add(p_items, std::memory_order_relaxed);
+		m_busy_ns.fetch_add(p_busy_ns, std::memory_order_relaxed);
+		if(p_busy_ns > m_max_chunk_ns.load(std::memory_order_relaxed))
+		{
+			m_max_chunk_ns.store(p_busy_ns, std::memory_order_relaxed);
+		}
+	}
+
+	inline void add_blocked(uint64_t p_blocked_ns)
+	{
+		m_blocked_ns.fetch_add(p_blocked_ns, std::memory_order_relaxed);
+	}
+
+	inline stage_stats stats() const
+	{
+		return stage_stats
+		{
+			.chunks			= m_chunks		.load(std::memory_order_relaxed),
+			.items			= m_items		.load(std::memory_order_relaxed),
+			.busy_ns		= m_busy_ns		.load(std::memory_order_relaxed),
+			.blocked_ns		= m_blocked_ns	.load(std::memory_order_relaxed),
+			.max_chunk_ns	= m_max_chunk_ns.load(std::memory_order_relaxed),
+		};
+	}
+
+private:
+	std::atomic<uint64_t> m_chunks{0};
+	std::atomic<uint64_t> m_items{0};
+	std::atomic<uint64_t> m_busy_ns{0};
+	std::atomic<uint64_t> m_blocked_ns{0};
+	std::atomic<uint64_t> m_max_chunk_ns{0};
+};
+
+} //namespace unit::pipeline
+
+
+namespace unit::_p
+{
+
+/// \brief Measures elapsed time in nanoseconds since the last call
+class stage_clock
+{
+public:
+	inline uint64_t lap()
+	{
+		const std::chrono::steady_clock::time_point t_now = std::chrono::steady_clock::now();
+		const uint64_t t_elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(t_now - m_last).count());
+		m_last = t_now;
+		return t_elapsed;
+	}
+
+private:
+	std::chrono::steady_clock::time_point m_last = std::chrono::steady_clock::now();
+};
+
+} //namespace unit::_p
+
+
+namespace unit::pipeline
+{
+
+//======== ======== Stages ======== ========
+
+/// \brief Produces chunks with p_decoder until it returns 0, then closes p_out
+/// \param[in] p_decoder - called with the space of a chunk, returns the number of units written to it
+template<typename Unit_t, uintptr_t ChunkSize, typename Decoder_t>
+	requires std::is_invocable_r_v<uintptr_t, Decoder_t&, std::span<Unit_t>>
+void decode(Decoder_t p_decoder, chunk_queue<Unit_t, ChunkSize>& p_out, stage_counters& p_counters)
+{
+	_p::stage_clock t_clock;
+	while(true)
+	{
+		chunk<Unit_t, ChunkSize>& t_chunk = p_out.acquire_write();
+		p_counters.add_blocked(t_clock.lap());
+
+		const uintptr_t t_count = std::min<uintptr_t>(p_decoder(std::span<Unit_t>{t_chunk.m_data}), ChunkSize);
+		if(t_count == 0) break;
+
+		t_chunk.m_size = t_count;
+		p_out.commit_write();
+		p_counters.add_chunk(t_count, t_clock.lap());
+	}
+	p_out.close();
+}
+
+/// \brief Converts every unit from p_in into To_t and writes it to p_out
+template<typename From_t, typename To_t, uintptr_t ChunkSize>
+	requires std::is_constructible_v<To_t, const From_t&>
+void convert(chunk_queue<From_t, ChunkSize>& p_in, chunk_queue<To_t, ChunkSize>& p_out, stage_counters& p_counters)
+{
+	_p::stage_clock t_clock;
+	while(const chunk<From_t, ChunkSize>* const t_in = p_in.acquire_read())
+	{
+		chunk<To_t, ChunkSize>& t_out = p_out.acquire_write();
+		p_counters.add_blocked(t_clock.lap());
+
+		for(uintptr_t i = 0; i < t_in->m_size; ++i)
+		{
+			t_out.m_data[i] = To_t{t_in->m_data[i]};
+		}
+		const uintptr_t t_count = t_in->m_size;
+		t_out.m_size = t_count;
+
+		p_in.release_read();
+		p_out.commit_write();
+		p_counters.add_chunk(t_count, t_clock.lap());
+	}
+	p_out.close();
+}
+
+/// \brief Only forwards the units for which p_predicate returns true
+/// \note Surviving units are packed, chunks that end up empty are not forwarded
+template<typename Unit_t, uintptr_t ChunkSize, typename Predicate_t>
+	requires std::is_invocable_r_v<bool, Predicate_t&, const Unit_t&>
+void filter(chunk_queue<Unit_t, ChunkSize>& p_in, chunk_queue<Unit_t, ChunkSize>& p_out, Predicate_t p_predicate, stage_counters& p_counters)
+{
+	_p::stage_clock t_clock;
+	chunk<Unit_t, ChunkSize>* t_out = nullptr;
+	while(const chunk<Unit_t, ChunkSize>* const t_in = p_in.acquire_read())
+	{
+		p_counters.add_blocked(t_clock.lap());
+		uint64_t t_busy = 0;
+		for(uintptr_t i = 0; i < t_in->m_size; ++i)
+		{
+			if(!p_predicate(t_in->m_data[i])) continue;
+
+			if(t_out == nullptr)
+			{
+				t_busy += t_clock.lap();
+				t_out = &p_out.acquire_write();
+				p_counters.add_blocked(t_clock.lap());
+			}
+			t_out->m_data[t_out->m_size++] = t_in->m_data[i];
+			if(t_out->m_size == ChunkSize)
+			{
+				p_out.commit_write();
+				t_out = nullptr;
+			}
+		}
+		const uintptr_t t_count = t_in->m_size;
+		p_in.release_read();
+		p_counters.add_chunk(t_count, t_busy + t_clock.lap());
+	}
+
+	if(t_out != nullptr)
+	{
+		p_out.commit_write();
+	}
+	p_out.close();
+}
+
+/// \brief Folds every unit from p_in with p_op starting from p_init
+template<typename Unit_t, uintptr_t ChunkSize, typename Result_t, typename Op_t>
+	requires std::is_invocable_r_v<Result_t, Op_t&, const Result_t&, const Unit_t&>
+Result_t aggregate(chunk_queue<Unit_t, ChunkSize>& p_in, Result_t p_init, Op_t p_op, stage_counters& p_counters)
+{
+	_p::stage_clock t_clock;
+	while(const chunk<Unit_t, ChunkSize>* const t_in = p_in.acquire_read())
+	{
+		p_counters.add_blocked(t_clock.lap());
+		for(uintptr_t i = 0; i < t_in->m_size; ++i)
+		{
+			p_init = p_op(std::as_const(p_init), t_in->m_data[i]);
+		}
+		const uintptr_t t_count = t_in->m_size;
+		p_in.release_read();
+		p_counters.add_chunk(t_count, t_clock.lap());
+	}
+	return p_init;
+}
+
+
+//======== ======== Runner ======== ========
+
+/// \brief Owns the threads that run the stages of a pipeline
+class runner
+{
+public:
+	runner() = default;
+	runner(const runner&) = delete;
+	runner& operator = (const runner&) = delete;
+
+	inline ~runner() { join(); }
+
+	/// \brief Starts p_stage on its own thread
+	template<typename Stage_t>
+	inline void spawn(Stage_t&& p_stage)
+	{
+		m_threads.emplace_back(std::forward<Stage_t>(p_stage));
+	}
+
+	/// \brief Waits for every stage to finish
+	inline void join()
+	{
+		for(std::thread& t_thread: m_threads)
+		{
+			if(t_thread.joinable()) t_thread.join();
+		}
+		m_threads.clear();
+	}
+
+private:
+	std::vector<std::thread> m_threads;
+};
+
+} //namespace unit::pipeline
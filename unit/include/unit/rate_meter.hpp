@@ -0,0 +1,187 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "_p/unit_type.hpp"
+#include "alias_time.hpp"
+
+namespace unit
+{
+
+/// \brief Measures the rate at which a quantity accumulates over a rolling time window
+/// \tparam Unit_t - Type of the quantity being accumulated (ex. byte)
+/// \tparam Duration_t - Unit of time used for timestamps and for the width of the buckets
+/// \tparam BucketCount - Number of time buckets in the ring, bounds the longest window that can be queried
+/// \note Recording and querying are lock-free and the meter never allocates.
+///		A bucket is cleared before its new epoch is published, so a query never counts the previous lap under the new epoch.
+///		An increment that races with the recycling of its bucket may be dropped,
+///		or, if it was started for the previous lap, be counted in the new one.
+template<_p::c_unit Unit_t, _p::c_unit Duration_t = second, uintptr_t BucketCount = 64>
+class rate_meter
+{
+public:
+	using unit_t		= Unit_t;
+	using duration_t	= Duration_t;
+	using value_t		= typename Unit_t::value_t;
+	using rate_t		= decltype(std::declval<const Unit_t&>() / std::declval<const Duration_t&>());
+
+	static constexpr uintptr_t bucket_count = BucketCount;
+
+	static_assert(BucketCount != 0, "A rate meter requires at least one bucket");
+	static_assert(_p::c_compatible_unit_pack<typename Duration_t::unit_pack, typename second::unit_pack>, "Duration_t must be a unit of time");
+	static_assert(std::atomic<value_t>::is_always_lock_free, "value_t must have lock-free atomics");
+
+private:
+	static constexpr int64_t no_epoch = std::numeric_limits<int64_t>::min();
+	//bucket is being cleared, newer than any epoch so that no other thread tries to recycle it
+	static constexpr int64_t recycling_epoch = std::numeric_limits<int64_t>::max();
+
+	struct bucket
+	{
+		std::atomic<int64_t> epoch{no_epoch};
+		std::atomic<value_t> total{};
+	};
+
+public:
+	/// \param[in] p_bucket_width - time span covered by each bucket, must be positive
+	inline explicit rate_meter(const Duration_t& p_bucket_width)
+		: m_width{p_bucket_width}
+	{}
+
+	rate_meter(const rate_meter&) = delete;
+	rate_meter& operator = (const rate_meter&) = delete;
+
+	/// \brief Accumulates an increment at a given point in time
+	/// \note Increments older than the span covered by the ring are discarded
+	inline void record(const Unit_t& p_amount, const Duration_t& p_timestamp)
+	{
+		const int64_t t_epoch = epoch_of(p_timestamp);
+		bucket& t_bucket = m_buckets[slot_of(t_epoch)];
+
+		int64_t t_current = t_bucket.epoch.load(std::memory_order_acquire);
+		while(t_current < t_epoch)
+		{
+			if(t_bucket.epoch.compare_exchange_weak(t_current, recycling_epoch, std::memory_order_acquire, std::memory_order_acquire))
+			{
+				t_bucket.total.store(value_t{0}, std::memory_order_relaxed);
+				t_bucket.epoch.store(t_epoch, std::memory_order_release);
+				t_current = t_epoch;
+			}
+		}
+
+		if(t_current == t_epoch)
+		{
+			t_bucket.total.fetch_add(p_amount.value(), std::memory_order_relaxed);
+		}
+	}
+
+	/// \brief Total accumulated over the window that ends at p_now
+	/// \note The window is rounded up to a whole number of buckets, and clamped to the size of the ring
+	inline Unit_t total(const Duration_t& p_window, const Duration_t& p_now) const
+	{
+		const int64_t t_last = epoch_of(p_now);
+		const int64_t t_first = t_last - bucket_span(p_window) + 1;
+
+		value_t t_sum{0};
+		for(const bucket& t_bucket: m_buckets)
+		{
+			const int64_t t_epoch = t_bucket.epoch.load(std::memory_order_acquire);
+			if(t_epoch == recycling_epoch || t_epoch < t_first || t_epoch > t_last)
+			{
+				continue;
+			}
+
+			const value_t t_total = t_bucket.total.load(std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_acquire);
+			//the bucket was recycled while being read, the total may belong to the new lap
+			if(t_bucket.epoch.load(std::memory_order_relaxed) == t_epoch)
+			{
+				t_sum += t_total;
+			}
+		}
+		return Unit_t{t_sum};
+	}
+
+	/// \brief Average rate over the window that ends at p_now
+	/// \note The elapsed time is measured from the start of the oldest bucket in the window up to p_now,
+	///		so that the partially filled current bucket does not bias the rate downwards.
+	///		When p_now falls on the start of the oldest bucket no time has elapsed, one bucket width is used instead.
+	inline rate_t rate(const Duration_t& p_window, const Duration_t& p_now) const
+	{
+		const int64_t t_first = epoch_of(p_now) - bucket_span(p_window) + 1;
+		Duration_t t_elapsed = p_now - m_width * static_cast<value_t>(t_first);
+		if(t_elapsed.value() <= value_t{0})
+		{
+			t_elapsed = m_width;
+		}
+		return total(p_window, p_now) / t_elapsed;
+	}
+
+	/// \brief Discards everything recorded so far
+	inline void reset()
+	{
+		for(bucket& t_bucket: m_buckets)
+		{
+			t_bucket.epoch.store(no_epoch, std::memory_order_relaxed);
+			t_bucket.total.store(value_t{0}, std::memory_order_relaxed);
+		}
+	}
+
+	inline constexpr Duration_t bucket_width() const { return m_width; }
+
+private:
+	inline int64_t epoch_of(const Duration_t& p_timestamp) const
+	{
+		return static_cast<int64_t>(std::floor(p_timestamp.value() / m_width.value()));
+	}
+
+	inline int64_t bucket_span(const Duration_t& p_window) const
+	{
+		const int64_t t_span = static_cast<int64_t>(std::ceil(p_window.value() / m_width.value()));
+		if(t_span < 1) return 1;
+		if(t_span > static_cast<int64_t>(BucketCount)) return static_cast<int64_t>(BucketCount);
+		return t_span;
+	}
+
+	static inline uintptr_t slot_of(int64_t p_epoch)
+	{
+		constexpr int64_t t_count = static_cast<int64_t>(BucketCount);
+		return static_cast<uintptr_t>(((p_epoch % t_count) + t_count) % t_count);
+	}
+
+private:
+	const Duration_t m_width;
+	std::array<bucket, BucketCount> m_buckets;
+};
+
+} //namespace unit
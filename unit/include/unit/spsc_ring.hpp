@@ -0,0 +1,175 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "_p/utils.hpp"
+#include "_p/unit_type.hpp"
+#include "_p/offset_unit.hpp"
+
+namespace unit
+{
+
+/// \brief Lock-free single producer, single consumer ring buffer of unit samples
+/// \tparam Unit_t - Type of the samples being queued
+/// \tparam Capacity - Maximum number of samples in the queue, must be a power of 2
+/// \note push functions may only be called by one thread, and pop functions by one other thread.
+///		Storage is held inline, the ring never allocates.
+template<typename Unit_t, uintptr_t Capacity>
+	requires (_p::c_unit<Unit_t> || _p::c_offset_unit<Unit_t>)
+class spsc_ring
+{
+public:
+	using unit_t = Unit_t;
+	static constexpr uintptr_t capacity = Capacity;
+
+	static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
+
+private:
+	static constexpr uintptr_t mask = Capacity - 1;
+
+public:
+	spsc_ring() = default;
+	spsc_ring(const spsc_ring&) = delete;
+	spsc_ring& operator = (const spsc_ring&) = delete;
+
+	//======== Producer ========
+	inline bool push(const Unit_t& p_sample)
+	{
+		const uintptr_t t_tail = m_tail.load(std::memory_order_relaxed);
+		if(t_tail - m_head_cache == Capacity)
+		{
+			m_head_cache = m_head.load(std::memory_order_acquire);
+			if(t_tail - m_head_cache == Capacity) return false;
+		}
+
+		m_buffer[t_tail & mask] = p_sample;
+		m_tail.store(t_tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// \return Number of samples pushed, from the front of p_samples
+	inline uintptr_t push(std::span<const Unit_t> p_samples)
+	{
+		const uintptr_t t_tail = m_tail.load(std::memory_order_relaxed);
+		uintptr_t t_free = Capacity - (t_tail - m_head_cache);
+		if(t_free < p_samples.size())
+		{
+			m_head_cache = m_head.load(std::memory_order_acquire);
+			t_free = Capacity - (t_tail - m_head_cache);
+		}
+
+		const uintptr_t t_count = std::min<uintptr_t>(t_free, p_samples.size());
+		const uintptr_t t_offset = t_tail & mask;
+		const uintptr_t t_first = std::min(t_count, Capacity - t_offset);
+
+		std::copy_n(p_samples.data(), t_first, m_buffer.data() + t_offset);
+		std::copy_n(p_samples.data() + t_first, t_count - t_first, m_buffer.data());
+
+		m_tail.store(t_tail + t_count, std::memory_order_release);
+		return t_count;
+	}
+
+	//======== Consumer ========
+	inline bool pop(Unit_t& p_sample)
+	{
+		const uintptr_t t_head = m_head.load(std::memory_order_relaxed);
+		if(t_head == m_tail_cache)
+		{
+			m_tail_cache = m_tail.load(std::memory_order_acquire);
+			if(t_head == m_tail_cache) return false;
+		}
+
+		p_sample = m_buffer[t_head & mask];
+		m_head.store(t_head + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// \brief Pops as many samples as are available and fit in p_out, converting them to Out_t
+	/// \return Number of samples written to the front of p_out
+	template<typename Out_t, std::size_t Extent> requires std::is_constructible_v<Out_t, const Unit_t&>
+	inline uintptr_t pop(std::span<Out_t, Extent> p_out)
+	{
+		const uintptr_t t_head = m_head.load(std::memory_order_relaxed);
+		uintptr_t t_available = m_tail_cache - t_head;
+		if(t_available < p_out.size())
+		{
+			m_tail_cache = m_tail.load(std::memory_order_acquire);
+			t_available = m_tail_cache - t_head;
+		}
+
+		const uintptr_t t_count = std::min<uintptr_t>(t_available, p_out.size());
+		const uintptr_t t_offset = t_head & mask;
+		const uintptr_t t_first = std::min(t_count, Capacity - t_offset);
+
+		const Unit_t* const t_buffer = m_buffer.data();
+		Out_t* const t_out = p_out.data();
+		for(uintptr_t i = 0; i < t_first; ++i)
+		{
+			t_out[i] = Out_t{t_buffer[t_offset + i]};
+		}
+		for(uintptr_t i = t_first; i < t_count; ++i)
+		{
+			t_out[i] = Out_t{t_buffer[i - t_first]};
+		}
+
+		m_head.store(t_head + t_count, std::memory_order_release);
+		return t_count;
+	}
+
+	//======== Either side ========
+	/// \note Only a snapshot, the value may be outdated by the time it is used
+	inline uintptr_t size() const
+	{
+		//head first, the tail is never behind any head read before it so the difference can not wrap
+		const uintptr_t t_head = m_head.load(std::memory_order_acquire);
+		const uintptr_t t_size = m_tail.load(std::memory_order_acquire) - t_head;
+		//both ends may have moved between the loads
+		return t_size < Capacity ? t_size : Capacity;
+	}
+
+	inline bool empty() const { return size() == 0; }
+
+private:
+	//consumer side
+	alignas(_p::cache_line_size) std::atomic<uintptr_t> m_head{0};
+	uintptr_t m_tail_cache = 0;
+
+	//producer side
+	alignas(_p::cache_line_size) std::atomic<uintptr_t> m_tail{0};
+	uintptr_t m_head_cache = 0;
+
+	alignas(_p::cache_line_size) std::array<Unit_t, Capacity> m_buffer;
+};
+
+} //namespace unit
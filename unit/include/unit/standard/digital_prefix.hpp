@@ -31,13 +31,13 @@
 namespace unit::multi
 {
 
-template<int8_t rank> using yobi = _p::scalar<bi, 24 * rank>;
-template<int8_t rank> using zebi = _p::scalar<bi, 21 * rank>;
-template<int8_t rank> using exbi = _p::scalar<bi, 18 * rank>;
-template<int8_t rank> using pebi = _p::scalar<bi, 15 * rank>;
-template<int8_t rank> using tebi = _p::scalar<bi, 12 * rank>;
-template<int8_t rank> using gibi = _p::scalar<bi,  9 * rank>;
-template<int8_t rank> using mebi = _p::scalar<bi,  6 * rank>;
-template<int8_t rank> using kibi = _p::scalar<bi,  3 * rank>;
+template<int8_t rank> using yobi = _p::scalar<bi, 8 * rank>;
+template<int8_t rank> using zebi = _p::scalar<bi, 7 * rank>;
+template<int8_t rank> using exbi = _p::scalar<bi, 6 * rank>;
+template<int8_t rank> using pebi = _p::scalar<bi, 5 * rank>;
+template<int8_t rank> using tebi = _p::scalar<bi, 4 * rank>;
+template<int8_t rank> using gibi = _p::scalar<bi, 3 * rank>;
+template<int8_t rank> using mebi = _p::scalar<bi, 2 * rank>;
+template<int8_t rank> using kibi = _p::scalar<bi, 1 * rank>;
 
 } //namespace unit::multi
@@ -48,3 +48,8 @@
 #include "alias_torque.hpp"
 #include "alias_velocity.hpp"
 #include "alias_volume.hpp"
+
+#if defined(UNIT_EXTERN_TEMPLATES)
+//common aliases are instantiated by the unit_instantiation library
+#include "extern_templates.hpp"
+#endif
@@ -0,0 +1,145 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <optional>
+
+#include "_p/unit_type.hpp"
+#include "_p/offset_unit.hpp"
+#include "_p/dynamic_signature.hpp"
+
+namespace unit
+{
+
+/// \brief Describes a unit only known at runtime
+/// \details A value v in this unit is (v + offset()) * gauge() in SI units.
+///	The offset is only non-zero for units like celcius or fahrenheit.
+class unit_descriptor
+{
+public:
+	inline constexpr unit_descriptor(): m_signature{}, m_gauge{1.0}, m_offset{0.0} {}
+
+	inline constexpr unit_descriptor(_p::dynamic_signature p_signature, double p_gauge, double p_offset = 0.0)
+		: m_signature{p_signature}
+		, m_gauge{p_gauge}
+		, m_offset{p_offset}
+	{}
+
+	inline constexpr _p::dynamic_signature signature() const { return m_signature; }
+	inline constexpr double gauge() const { return m_gauge; }
+	inline constexpr double offset() const { return m_offset; }
+	inline constexpr bool has_offset() const { return m_offset != 0.0; }
+
+	inline constexpr bool compatible(const unit_descriptor& p_other) const
+	{
+		return m_signature == p_other.m_signature;
+	}
+
+	/// \brief Descriptor of the product of 2 units
+	/// \return std::nullopt if either unit has an offset
+	inline constexpr std::optional<unit_descriptor> multiply(const unit_descriptor& p_other) const
+	{
+		if(has_offset() || p_other.has_offset())
+		{
+			return std::nullopt;
+		}
+		return unit_descriptor{m_signature * p_other.m_signature, m_gauge * p_other.m_gauge};
+	}
+
+	/// \brief Descriptor of the quotient of 2 units
+	/// \return std::nullopt if either unit has an offset
+	inline constexpr std::optional<unit_descriptor> divide(const unit_descriptor& p_other) const
+	{
+		if(has_offset() || p_other.has_offset())
+		{
+			return std::nullopt;
+		}
+		return unit_descriptor{m_signature / p_other.m_signature, m_gauge / p_other.m_gauge};
+	}
+
+	inline constexpr bool operator == (const unit_descriptor&) const = default;
+
+private:
+	_p::dynamic_signature	m_signature;
+	double					m_gauge;
+	double					m_offset;
+};
+
+
+/// \brief Conversion between 2 units as an affine map, to = from * scale + shift
+struct affine_conversion
+{
+	double scale = 1.0;
+	double shift = 0.0;
+
+	template<_p::c_ValidFP Type>
+	inline constexpr Type apply(Type p_value) const
+	{
+		return p_value * static_cast<Type>(scale) + static_cast<Type>(shift);
+	}
+};
+
+/// \brief Conversion of values from one unit to another
+/// \return std::nullopt if units are not compatible
+inline constexpr std::optional<affine_conversion> make_conversion(const unit_descriptor& p_from, const unit_descriptor& p_to)
+{
+	if(!p_from.compatible(p_to))
+	{
+		return std::nullopt;
+	}
+	if(p_from.gauge() == p_to.gauge())
+	{
+		return affine_conversion{1.0, p_from.offset() - p_to.offset()};
+	}
+	const double t_scale = p_from.gauge() / p_to.gauge();
+	return affine_conversion{t_scale, p_from.offset() * t_scale - p_to.offset()};
+}
+
+
+namespace _p
+{
+	template<typename T>
+	struct descriptor_of;
+
+	template<c_ValidFP Type, c_dynamic_unit_pack Pack>
+	struct descriptor_of<Unit<Type, Pack>>
+	{
+		static constexpr unit_descriptor value{dynamic_signature_v<Pack>, static_cast<double>(Pack::gauge)};
+	};
+
+	template<c_ValidFP Type, c_proxy_property Property> requires c_dynamic_unit_pack<typename Offset_Unit<Type, Property>::unit_pack_t>
+	struct descriptor_of<Offset_Unit<Type, Property>>
+	{
+		using unit_pack_t = typename Offset_Unit<Type, Property>::unit_pack_t;
+		static constexpr unit_descriptor value{dynamic_signature_v<unit_pack_t>, static_cast<double>(unit_pack_t::gauge), static_cast<double>(Property::offset)};
+	};
+} //namespace _p
+
+/// \brief Runtime descriptor of a static unit or offset unit
+template<typename Unit_t>
+inline constexpr unit_descriptor unit_descriptor_v = _p::descriptor_of<Unit_t>::value;
+
+} //namespace unit
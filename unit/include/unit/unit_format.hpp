@@ -0,0 +1,402 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+#include "_p/unit_symbols.hpp"
+
+namespace unit
+{
+
+namespace _p
+{
+	//======== ======== Symbol lookup ======== ========
+
+	template<typename T>
+	struct symbol_unit_pack
+	{
+		using type = void;
+	};
+
+	template<c_ValidFP Type, c_unit_pack Pack>
+	struct symbol_unit_pack<Unit<Type, Pack>>
+	{
+		using type = Pack;
+	};
+
+	/// \brief Index of the symbol whose alias is Unit_t
+	template<typename Unit_t, typename... Defs>
+	consteval uint8_t find_alias_symbol(core::pack<Defs...>*)
+	{
+		constexpr std::array<bool, sizeof...(Defs)> t_matches = {std::is_same_v<typename Defs::template type<typename Unit_t::value_t>, Unit_t>...};
+		for(uint8_t i = 0; i < t_matches.size(); ++i)
+		{
+			if(t_matches[i]) return i;
+		}
+		return no_symbol;
+	}
+
+	/// \brief Unit_t without its scalar, when it has exactly one, ex. pascal for kilopascal
+	template<typename T>
+	struct unprefixed_unit
+	{
+		using type = void;
+		using scalar_t = void;
+	};
+
+	template<c_ValidFP Type, c_dimension... Dimensions, c_scalar Scalar>
+	struct unprefixed_unit<Unit<Type, unit_pack<core::pack<Dimensions...>, core::pack<Scalar>>>>
+	{
+		using type = Unit<Type, unit_pack<core::pack<Dimensions...>, core::pack<>>>;
+		using scalar_t = Scalar;
+	};
+
+	/// \brief Index of the symbol of a standard on its own, ex. "ft" for foot
+	template<c_standard Standard, typename... Defs>
+	consteval uint8_t find_standard_symbol(core::pack<Defs...>*)
+	{
+		using standard_pack = unit_pack<core::pack<dimension<Standard, 1>>, core::pack<>>;
+		constexpr std::array<bool, sizeof...(Defs)> t_matches = {std::is_same_v<typename symbol_unit_pack<typename Defs::template type<long double>>::type, standard_pack>...};
+		for(uint8_t i = 0; i < t_matches.size(); ++i)
+		{
+			if(t_matches[i]) return i;
+		}
+		return no_symbol;
+	}
+
+	/// \brief Index of the prefix that, applied to a symbol of rank Rank, is Scalar
+	template<typename Scalar, int8_t Rank, typename... Defs>
+	consteval uint8_t find_scalar_prefix(core::pack<Defs...>*)
+	{
+		constexpr std::array<bool, sizeof...(Defs)> t_matches = {std::is_same_v<typename Defs::template type<Rank>, Scalar>...};
+		for(uint8_t i = 0; i < t_matches.size(); ++i)
+		{
+			if(t_matches[i]) return i;
+		}
+		return no_symbol;
+	}
+
+
+	//======== ======== Symbol composition ======== ========
+
+	/// \brief Enough room for the symbol of any unit in a unit_signature
+	inline constexpr uintptr_t max_symbol_size = 96;
+
+	struct symbol_buffer
+	{
+		std::array<char, max_symbol_size> text{};
+		uintptr_t size = 0;
+
+		constexpr void append(std::string_view p_text)
+		{
+			for(const char t_char : p_text) text[size++] = t_char;
+		}
+
+		constexpr void append_rank(int8_t p_rank)
+		{
+			if(p_rank < 0)
+			{
+				text[size++] = '-';
+			}
+			const uint8_t t_rank = static_cast<uint8_t>(p_rank < 0 ? -p_rank : p_rank);
+			if(t_rank >= 100) text[size++] = static_cast<char>('0' + t_rank / 100);
+			if(t_rank >= 10) text[size++] = static_cast<char>('0' + t_rank / 10 % 10);
+			text[size++] = static_cast<char>('0' + t_rank % 10);
+		}
+	};
+
+	/// \brief Composes the symbol of a unit at compile time, see unit_symbol
+	template<typename Unit_t>
+	struct unit_symbol_builder
+	{
+	private:
+		struct term
+		{
+			uint8_t symbol;
+			uint8_t prefix;
+			int8_t rank;
+		};
+
+		template<c_dimension Dimension>
+		static constexpr term dimension_term(long double& p_factor)
+		{
+			constexpr uint8_t t_symbol = find_standard_symbol<typename Dimension::standard_t>(static_cast<unit_symbol_pack*>(nullptr));
+			if constexpr(t_symbol != no_symbol)
+			{
+				return term{t_symbol, no_symbol, Dimension::rank};
+			}
+			else
+			{
+				using si_t = typename standard::SI_standard<typename Dimension::metric_t>::type;
+				p_factor *= Dimension::factor;
+				return term{find_standard_symbol<si_t>(static_cast<unit_symbol_pack*>(nullptr)), no_symbol, Dimension::rank};
+			}
+		}
+
+		template<uintptr_t Size>
+		static constexpr uintptr_t first_numerator(const std::array<int8_t, Size>& p_ranks)
+		{
+			for(uintptr_t i = 0; i < Size; ++i)
+			{
+				if(p_ranks[i] > 0) return i;
+			}
+			return Size;
+		}
+
+		template<c_dimension... Dimensions, c_scalar... Scalars>
+		static constexpr symbol_buffer compose(long double& p_factor, core::pack<Dimensions...>*, core::pack<Scalars...>*)
+		{
+			std::array<term, sizeof...(Dimensions)> t_terms = {dimension_term<Dimensions>(p_factor)...};
+
+			//a single scalar may become the prefix of the first symbol of the numerator
+			bool t_prefixed = false;
+			constexpr uintptr_t t_first = first_numerator(std::array<int8_t, sizeof...(Dimensions)>{Dimensions::rank...});
+			if constexpr(sizeof...(Scalars) == 1 && t_first < sizeof...(Dimensions))
+			{
+				using first_t = core::pack_get_t<core::pack<Dimensions...>, t_first>;
+				using scalar_t = core::pack_get_t<core::pack<Scalars...>, 0>;
+				constexpr uint8_t t_prefix = find_scalar_prefix<scalar_t, first_t::rank>(static_cast<unit_prefix_pack*>(nullptr));
+				if constexpr(t_prefix != no_symbol)
+				{
+					if(p_factor == 1.l && accepts_prefix(symbol_entries[t_terms[t_first].symbol].prefixes, prefix_entries[t_prefix].kind))
+					{
+						t_terms[t_first].prefix = t_prefix;
+						t_prefixed = true;
+					}
+				}
+			}
+			if(!t_prefixed)
+			{
+				((p_factor *= Scalars::factor), ...);
+			}
+
+			symbol_buffer t_buffer;
+			bool t_numerator = false;
+			for(const term& t_term : t_terms)
+			{
+				if(t_term.rank < 0) continue;
+				if(t_numerator) t_buffer.append("*");
+				if(t_term.prefix != no_symbol) t_buffer.append(prefix_entries[t_term.prefix].symbol);
+				t_buffer.append(symbol_entries[t_term.symbol].symbol);
+				if(t_term.rank != 1)
+				{
+					t_buffer.append("^");
+					t_buffer.append_rank(t_term.rank);
+				}
+				t_numerator = true;
+			}
+			if(!t_numerator)
+			{
+				t_buffer.append("1");
+			}
+			for(const term& t_term : t_terms)
+			{
+				if(t_term.rank > 0) continue;
+				t_buffer.append("/");
+				if(t_term.prefix != no_symbol) t_buffer.append(prefix_entries[t_term.prefix].symbol);
+				t_buffer.append(symbol_entries[t_term.symbol].symbol);
+				if(t_term.rank != -1)
+				{
+					t_buffer.append("^");
+					t_buffer.append_rank(static_cast<int8_t>(-t_term.rank));
+				}
+			}
+			return t_buffer;
+		}
+
+		/// \brief Alias of Unit_t without its scalar, with the scalar as its prefix, ex. "Pa" and "k" for kilopascal
+		static consteval term prefixed_alias()
+		{
+			using unprefixed_t = unprefixed_unit<Unit_t>;
+			if constexpr(!std::is_void_v<typename unprefixed_t::type>)
+			{
+				constexpr uint8_t t_alias = find_alias_symbol<typename unprefixed_t::type>(static_cast<unit_symbol_pack*>(nullptr));
+				constexpr uint8_t t_prefix = find_scalar_prefix<typename unprefixed_t::scalar_t, 1>(static_cast<unit_prefix_pack*>(nullptr));
+				if constexpr(t_alias != no_symbol && t_prefix != no_symbol)
+				{
+					if(accepts_prefix(symbol_entries[t_alias].prefixes, prefix_entries[t_prefix].kind))
+					{
+						return term{t_alias, t_prefix, 1};
+					}
+				}
+			}
+			return term{no_symbol, no_symbol, 0};
+		}
+
+	public:
+		struct result
+		{
+			symbol_buffer buffer;
+			long double factor;
+		};
+
+		static constexpr result make()
+		{
+			constexpr uint8_t t_alias = find_alias_symbol<Unit_t>(static_cast<unit_symbol_pack*>(nullptr));
+			constexpr term t_prefixed = prefixed_alias();
+			result t_result{symbol_buffer{}, 1.l};
+			if constexpr(t_alias != no_symbol)
+			{
+				t_result.buffer.append(symbol_entries[t_alias].symbol);
+			}
+			else if constexpr(t_prefixed.symbol != no_symbol)
+			{
+				t_result.buffer.append(prefix_entries[t_prefixed.prefix].symbol);
+				t_result.buffer.append(symbol_entries[t_prefixed.symbol].symbol);
+			}
+			else
+			{
+				using pack_t = typename Unit_t::unit_pack;
+				t_result.buffer = compose(t_result.factor,
+					static_cast<typename pack_t::dimension_pack*>(nullptr),
+					static_cast<typename pack_t::scalar_pack*>(nullptr));
+			}
+			return t_result;
+		}
+
+		template<uintptr_t... Index>
+		static consteval std::array<char, sizeof...(Index)> trim(const symbol_buffer& p_buffer, std::integer_sequence<uintptr_t, Index...>)
+		{
+			return {p_buffer.text[Index]...};
+		}
+	};
+
+	/// \brief Symbol of a unit, and the factor its values must be multiplied by to be expressed in it
+	/// \details Aliases in the symbol table use their own symbol, ex. "N" or "degC",
+	///	and an alias with a single scalar that is a prefix the alias accepts uses the prefixed symbol, ex. "kPa".
+	///	Otherwise the symbol is composed from the dimensions, ex. "km/h", with the scalars folded into a prefix when possible.
+	///	Standards without a symbol, and scalars that can not be written as a prefix, are converted to SI instead,
+	///	and contribute to the factor.
+	template<typename Unit_t>
+	struct unit_symbol
+	{
+	private:
+		using builder_t = unit_symbol_builder<Unit_t>;
+
+		static constexpr typename builder_t::result m_result = builder_t::make();
+		static constexpr std::array<char, m_result.buffer.size> m_text =
+			builder_t::trim(m_result.buffer, std::make_integer_sequence<uintptr_t, m_result.buffer.size>{});
+
+	public:
+		static constexpr std::string_view symbol{m_text.data(), m_text.size()};
+		static constexpr long double factor = m_result.factor;
+	};
+
+	template<typename Unit_t>
+	inline constexpr auto symbol_value(const Unit_t& p_unit)
+	{
+		using value_t = typename Unit_t::value_t;
+		if constexpr(unit_symbol<Unit_t>::factor == 1.l)
+		{
+			return p_unit.value();
+		}
+		else
+		{
+			return static_cast<value_t>(p_unit.value() * static_cast<value_t>(unit_symbol<Unit_t>::factor));
+		}
+	}
+
+	template<typename T>
+	concept c_formattable_unit = (c_unit<T> || c_offset_unit<T>) && requires { unit_symbol<T>::symbol; };
+
+	inline std::to_chars_result append_symbol(char* p_first, char* p_last, std::string_view p_symbol)
+	{
+		if(static_cast<uintptr_t>(p_last - p_first) < p_symbol.size() + 1)
+		{
+			return std::to_chars_result{p_last, std::errc::value_too_large};
+		}
+		*p_first++ = ' ';
+		for(const char t_char : p_symbol) *p_first++ = t_char;
+		return std::to_chars_result{p_first, std::errc{}};
+	}
+} //namespace _p
+
+
+/// \brief Symbol used to format a unit, ex. "km/h"
+template<typename Unit_t> requires (_p::c_unit<Unit_t> || _p::c_offset_unit<Unit_t>)
+inline constexpr std::string_view unit_symbol_v = _p::unit_symbol<Unit_t>::symbol;
+
+
+//======== ======== to_chars ======== ========
+//	Same overloads as std::to_chars for floating point, the value is followed by a space and the symbol of the unit.
+//	Nothing is allocated, std::errc::value_too_large is reported if the buffer is too small.
+
+template<_p::c_formattable_unit Unit_t>
+inline std::to_chars_result to_chars(char* p_first, char* p_last, const Unit_t& p_unit)
+{
+	const std::to_chars_result t_result = std::to_chars(p_first, p_last, _p::symbol_value(p_unit));
+	if(t_result.ec != std::errc{}) return t_result;
+	return _p::append_symbol(t_result.ptr, p_last, unit_symbol_v<Unit_t>);
+}
+
+template<_p::c_formattable_unit Unit_t>
+inline std::to_chars_result to_chars(char* p_first, char* p_last, const Unit_t& p_unit, std::chars_format p_format)
+{
+	const std::to_chars_result t_result = std::to_chars(p_first, p_last, _p::symbol_value(p_unit), p_format);
+	if(t_result.ec != std::errc{}) return t_result;
+	return _p::append_symbol(t_result.ptr, p_last, unit_symbol_v<Unit_t>);
+}
+
+template<_p::c_formattable_unit Unit_t>
+inline std::to_chars_result to_chars(char* p_first, char* p_last, const Unit_t& p_unit, std::chars_format p_format, int p_precision)
+{
+	const std::to_chars_result t_result = std::to_chars(p_first, p_last, _p::symbol_value(p_unit), p_format, p_precision);
+	if(t_result.ec != std::errc{}) return t_result;
+	return _p::append_symbol(t_result.ptr, p_last, unit_symbol_v<Unit_t>);
+}
+
+} //namespace unit
+
+
+#if defined(__cpp_lib_format)
+/// \brief Formats the value with the same specifiers as the underlying floating point type, followed by the symbol
+///	ex. std::format("{:.2f}", kilometre_per_hour{3.14159}) gives "3.14 km/h"
+template<unit::_p::c_formattable_unit Unit_t, typename CharT>
+struct std::formatter<Unit_t, CharT>: std::formatter<typename Unit_t::value_t, CharT>
+{
+	template<typename FormatContext>
+	auto format(const Unit_t& p_unit, FormatContext& p_context) const
+	{
+		auto t_out = std::formatter<typename Unit_t::value_t, CharT>::format(unit::_p::symbol_value(p_unit), p_context);
+		*t_out++ = CharT{' '};
+		for(const char t_char : unit::unit_symbol_v<Unit_t>)
+		{
+			*t_out++ = static_cast<CharT>(t_char);
+		}
+		return t_out;
+	}
+};
+#endif
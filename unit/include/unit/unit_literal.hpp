@@ -0,0 +1,189 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+
+#include "unit_parser.hpp"
+
+namespace unit
+{
+
+namespace _p
+{
+	/// \brief Maximum number of terms in a unit expression resolved at compile time
+	inline constexpr uintptr_t max_unit_terms = 16;
+
+	struct unit_expression
+	{
+		std::array<unit_term, max_unit_terms> terms;
+		uintptr_t size;
+		std::errc error;
+		bool has_offset;
+	};
+
+	consteval unit_expression parse_unit_expression(std::string_view p_text)
+	{
+		unit_expression t_expression{};
+		t_expression.error = for_each_unit_term(p_text,
+			[&t_expression](const unit_term& p_term)
+			{
+				if(p_term.power == 0)
+				{
+					return true;
+				}
+				if(t_expression.size == max_unit_terms)
+				{
+					return false;
+				}
+				t_expression.has_offset |= symbol_entries[p_term.symbol.symbol].descriptor.has_offset();
+				t_expression.terms[t_expression.size++] = p_term;
+				return true;
+			});
+		return t_expression;
+	}
+
+
+	/// \brief Raises a dimension or a scalar to a power
+	template<typename Entry, int8_t Power>
+	struct raise;
+
+	template<c_standard Standard, int8_t Rank, int8_t Power>
+	struct raise<dimension<Standard, Rank>, Power>
+	{
+		static_assert(Rank * Power >= -128 && Rank * Power <= 127, "Rank out of range");
+		using type = dimension<Standard, static_cast<int8_t>(Rank * Power)>;
+	};
+
+	template<c_mutiplier Scalar, int8_t Rank, int8_t Power>
+	struct raise<scalar<Scalar, Rank>, Power>
+	{
+		static_assert(Rank * Power >= -128 && Rank * Power <= 127, "Power out of range");
+		using type = scalar<Scalar, static_cast<int8_t>(Rank * Power)>;
+	};
+
+	template<core::c_pack Pack, int8_t Power>
+	struct raise_pack;
+
+	template<typename... Entries, int8_t Power>
+	struct raise_pack<core::pack<Entries...>, Power>
+	{
+		using type = core::pack<typename raise<Entries, Power>::type...>;
+	};
+
+
+	/// \brief Dimensions and scalars of a single term of an expression
+	template<unit_term Term>
+	struct unit_term_packs
+	{
+	private:
+		using symbol_pack = typename core::pack_get_t<unit_symbol_pack, Term.symbol.symbol>::template type<long double>::unit_pack;
+		using symbol_scalars = typename raise_pack<typename symbol_pack::scalar_pack, Term.power>::type;
+
+		template<uint8_t Prefix>
+		struct prefix_scalars
+		{
+			using type = typename scalar_merge<symbol_scalars,
+				core::pack<typename core::pack_get_t<unit_prefix_pack, Prefix>::template type<Term.power>>>::type;
+		};
+
+		template<uint8_t Prefix> requires (Prefix == no_symbol)
+		struct prefix_scalars<Prefix>
+		{
+			using type = symbol_scalars;
+		};
+
+	public:
+		using dimension_pack = typename raise_pack<typename symbol_pack::dimension_pack, Term.power>::type;
+		using scalar_pack = typename prefix_scalars<Term.symbol.prefix>::type;
+	};
+
+
+	/// \brief Combines the terms of an expression into a single unit
+	template<c_ValidFP Type, unit_expression Expression, uintptr_t Index = 0, core::c_pack Dimensions = core::pack<>, core::c_pack Scalars = core::pack<>>
+	struct unit_expression_type
+	{
+	private:
+		using term = unit_term_packs<Expression.terms[Index]>;
+
+		static_assert(!has_conflicting_units<Dimensions, typename term::dimension_pack>::value,
+			"Unit expression mixes different standards of the same metric");
+
+	public:
+		using type = typename unit_expression_type<Type, Expression, Index + 1,
+			typename dimension_merge_no_clober<Dimensions, typename term::dimension_pack>::type,
+			typename scalar_merge<Scalars, typename term::scalar_pack>::type>::type;
+	};
+
+	template<c_ValidFP Type, unit_expression Expression, uintptr_t Index, core::c_pack Dimensions, core::c_pack Scalars> requires (Index == Expression.size)
+	struct unit_expression_type<Type, Expression, Index, Dimensions, Scalars>
+	{
+		static_assert(!core::is_pack_empty_v<Dimensions>, "Unit expression is dimensionless");
+		using type = typename make_unit<Type, Dimensions, Scalars>::type;
+	};
+
+	/// \brief Units with an offset can only appear on their own
+	template<c_ValidFP Type, unit_expression Expression> requires (Expression.has_offset)
+	struct unit_expression_type<Type, Expression, 0, core::pack<>, core::pack<>>
+	{
+		static_assert(Expression.size == 1 && Expression.terms[0].power == 1, "Units with an offset can not be combined with other units");
+		using type = typename core::pack_get_t<unit_symbol_pack, Expression.terms[0].symbol.symbol>::template type<Type>;
+	};
+
+	template<fixed_string Text>
+	inline constexpr unit_expression unit_expression_v = parse_unit_expression(Text.view());
+
+	template<fixed_string Text>
+	consteval bool check_unit_expression()
+	{
+		static_assert(unit_expression_v<Text>.error != std::errc::result_out_of_range, "Unit expression has a power out of range");
+		static_assert(unit_expression_v<Text>.error == std::errc{}, "Invalid unit expression, or too many terms");
+		return true;
+	}
+} //namespace _p
+
+
+/// \brief Static unit type described by a unit expression, ex. parse_t<"kN*m">
+/// \details Accepts the same expressions as parse_unit, resolved entirely at compile time.
+///	The result is the same type make_unit would produce for the equivalent dimensions and scalars,
+///	units with an offset like "degC" resolve to their Offset_Unit.
+template<_p::fixed_string Text, _p::c_ValidFP Type = _p::default_fp> requires (_p::check_unit_expression<Text>())
+using parse_t = typename _p::unit_expression_type<Type, _p::unit_expression_v<Text>>::type;
+
+namespace literals
+{
+	/// \brief A value of 1 in the unit described by the expression, ex. 9.8 * "m/s^2"_u
+	template<_p::fixed_string Text>
+	consteval parse_t<Text> operator""_u()
+	{
+		return parse_t<Text>{1};
+	}
+} //namespace literals
+
+} //namespace unit
@@ -0,0 +1,342 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <system_error>
+
+#include "unit_descriptor.hpp"
+#include "_p/unit_symbols.hpp"
+
+namespace unit
+{
+
+namespace _p
+{
+	inline constexpr bool is_symbol_char(char p_char)
+	{
+		return (p_char >= 'a' && p_char <= 'z') || (p_char >= 'A' && p_char <= 'Z') || static_cast<uint8_t>(p_char) >= 0x80;
+	}
+
+	inline constexpr bool is_digit_char(char p_char)
+	{
+		return p_char >= '0' && p_char <= '9';
+	}
+
+	inline constexpr uintptr_t skip_spaces(std::string_view p_text, uintptr_t p_pos)
+	{
+		while(p_pos < p_text.size() && p_text[p_pos] == ' ')
+		{
+			++p_pos;
+		}
+		return p_pos;
+	}
+
+	/// \brief A symbol in a unit expression raised to a power
+	struct unit_term
+	{
+		resolved_symbol symbol;
+		int8_t power;
+	};
+
+	/// \brief Splits a unit expression into terms
+	/// \details Accepts terms separated by '*' or '/', each term optionally raised to an integer power with '^'.
+	///	Division applies to the next term only, "J/kg*K" is (J/kg)*K.
+	///	A leading "1" is accepted for expressions like "1/s".
+	/// \param[in] p_callback - called for each term, returns false to stop
+	/// \return std::errc::invalid_argument if the expression is malformed or a symbol is not known,
+	///		std::errc::result_out_of_range if a power is out of range
+	template<typename Callback>
+	inline constexpr std::errc for_each_unit_term(std::string_view p_text, Callback&& p_callback)
+	{
+		uintptr_t t_pos = skip_spaces(p_text, 0);
+		if(t_pos == p_text.size())
+		{
+			return std::errc::invalid_argument;
+		}
+
+		bool t_divide = false;
+		bool t_first = true;
+		while(true)
+		{
+			t_pos = skip_spaces(p_text, t_pos);
+
+			unit_term t_term{resolved_symbol{}, 1};
+			if(t_first && t_pos < p_text.size() && p_text[t_pos] == '1' && (t_pos + 1 == p_text.size() || !is_digit_char(p_text[t_pos + 1])))
+			{
+				++t_pos;
+				t_term.power = 0;
+			}
+			else
+			{
+				const uintptr_t t_begin = t_pos;
+				while(t_pos < p_text.size() && is_symbol_char(p_text[t_pos]))
+				{
+					++t_pos;
+				}
+				if(t_pos == t_begin)
+				{
+					return std::errc::invalid_argument;
+				}
+				t_term.symbol = resolve_symbol(p_text.substr(t_begin, t_pos - t_begin));
+				if(t_term.symbol.symbol == no_symbol)
+				{
+					return std::errc::invalid_argument;
+				}
+
+				int32_t t_power = 1;
+				if(t_pos < p_text.size() && p_text[t_pos] == '^')
+				{
+					++t_pos;
+					bool t_negative = false;
+					if(t_pos < p_text.size() && (p_text[t_pos] == '-' || p_text[t_pos] == '+'))
+					{
+						t_negative = p_text[t_pos] == '-';
+						++t_pos;
+					}
+					if(t_pos == p_text.size() || !is_digit_char(p_text[t_pos]))
+					{
+						return std::errc::invalid_argument;
+					}
+					t_power = 0;
+					while(t_pos < p_text.size() && is_digit_char(p_text[t_pos]))
+					{
+						t_power = t_power * 10 + (p_text[t_pos] - '0');
+						if(t_power > 128)
+						{
+							return std::errc::result_out_of_range;
+						}
+						++t_pos;
+					}
+					if(t_negative)
+					{
+						t_power = -t_power;
+					}
+				}
+				if(t_divide)
+				{
+					t_power = -t_power;
+				}
+				//-128 is a valid power, 128 is not
+				if(t_power < -128 || t_power > 127)
+				{
+					return std::errc::result_out_of_range;
+				}
+				t_term.power = static_cast<int8_t>(t_power);
+			}
+
+			if(!p_callback(t_term))
+			{
+				return std::errc::invalid_argument;
+			}
+
+			t_first = false;
+			t_pos = skip_spaces(p_text, t_pos);
+			if(t_pos == p_text.size())
+			{
+				return std::errc{};
+			}
+
+			if(p_text[t_pos] == '*')
+			{
+				t_divide = false;
+			}
+			else if(p_text[t_pos] == '/')
+			{
+				t_divide = true;
+			}
+			else
+			{
+				return std::errc::invalid_argument;
+			}
+			++t_pos;
+		}
+	}
+
+	/// \brief Characters that can appear in a unit expression without surrounding spaces
+	inline constexpr bool is_unit_expression_char(char p_char)
+	{
+		return is_symbol_char(p_char) || is_digit_char(p_char) || p_char == '*' || p_char == '/' || p_char == '^' || p_char == '-' || p_char == '+';
+	}
+
+	inline constexpr double integer_power(double p_value, int8_t p_power)
+	{
+		double t_result = 1.0;
+		for(int8_t i = 0; i < p_power; ++i) t_result *= p_value;
+		for(int8_t i = 0; i > p_power; --i) t_result /= p_value;
+		return t_result;
+	}
+} //namespace _p
+
+
+/// \brief Parses a unit expression into a runtime descriptor
+/// \details Examples of accepted expressions are "kg*m/s^2", "km/h", "MiB", "1/s" or "degC".
+///	Symbols and prefixes are looked up in a perfect hash table generated at compile time, nothing is allocated.
+///	Units with an offset, like "degC", are only accepted on their own.
+/// \param[out] p_out - only written on success
+/// \return std::errc{} on success, std::errc::invalid_argument if the expression is malformed or uses unknown symbols,
+///		std::errc::result_out_of_range if powers are out of range
+inline constexpr std::errc parse_unit(std::string_view p_text, unit_descriptor& p_out)
+{
+	std::array<int32_t, _p::dynamic_lane_count> t_ranks{};
+	double t_gauge = 1.0;
+	double t_offset = 0.0;
+	uintptr_t t_terms = 0;
+	bool t_has_offset = false;
+	bool t_rank_overflow = false;
+	constexpr int32_t rank_bound = 0x7FFF;
+
+	const std::errc t_error = _p::for_each_unit_term(p_text,
+		[&](const _p::unit_term& p_term)
+		{
+			++t_terms;
+			if(t_has_offset || p_term.power == 0)
+			{
+				//"1" can only start an expression, and nothing can follow an offset unit
+				return !t_has_offset;
+			}
+
+			const unit_descriptor& t_descriptor = _p::symbol_entries[p_term.symbol.symbol].descriptor;
+			if(t_descriptor.has_offset())
+			{
+				if(t_terms != 1 || p_term.power != 1)
+				{
+					return false;
+				}
+				t_has_offset = true;
+				t_offset = t_descriptor.offset();
+			}
+
+			double t_factor = t_descriptor.gauge();
+			if(p_term.symbol.prefix != _p::no_symbol)
+			{
+				t_factor *= _p::prefix_entries[p_term.symbol.prefix].factor;
+			}
+			t_gauge *= _p::integer_power(t_factor, p_term.power);
+
+			for(uint8_t t_lane = 0; t_lane < _p::dynamic_lane_count; ++t_lane)
+			{
+				t_ranks[t_lane] += t_descriptor.signature().rank(t_lane) * p_term.power;
+				//terms may cancel out, only bound the running rank so that it can not overflow
+				if(t_ranks[t_lane] < -rank_bound || t_ranks[t_lane] > rank_bound)
+				{
+					t_rank_overflow = true;
+					return false;
+				}
+			}
+			return true;
+		});
+
+	if(t_rank_overflow)
+	{
+		return std::errc::result_out_of_range;
+	}
+	if(t_error != std::errc{})
+	{
+		return t_error;
+	}
+
+	_p::dynamic_signature t_signature;
+	for(uint8_t t_lane = 0; t_lane < _p::dynamic_lane_count; ++t_lane)
+	{
+		if(t_ranks[t_lane] < -128 || t_ranks[t_lane] > 127)
+		{
+			return std::errc::result_out_of_range;
+		}
+		t_signature = t_signature * _p::dynamic_signature::from_rank(t_lane, static_cast<int8_t>(t_ranks[t_lane]));
+	}
+
+	p_out = unit_descriptor{t_signature, t_gauge, t_offset};
+	return std::errc{};
+}
+
+/// \brief Parses a unit expression and checks it against a static unit
+/// \param[out] p_out - conversion from values in the parsed unit to Unit_t, only written on success
+/// \return same as parse_unit, or std::errc::invalid_argument if the parsed unit is not compatible with Unit_t
+template<typename Unit_t> requires (_p::c_unit<Unit_t> || _p::c_offset_unit<Unit_t>)
+inline constexpr std::errc parse_unit_conversion(std::string_view p_text, affine_conversion& p_out)
+{
+	unit_descriptor t_descriptor;
+	if(const std::errc t_error = parse_unit(p_text, t_descriptor); t_error != std::errc{})
+	{
+		return t_error;
+	}
+
+	const std::optional<affine_conversion> t_conversion = make_conversion(t_descriptor, unit_descriptor_v<Unit_t>);
+	if(!t_conversion)
+	{
+		return std::errc::invalid_argument;
+	}
+	p_out = *t_conversion;
+	return std::errc{};
+}
+
+/// \brief Parses a quantity with a unit suffix, ex. "12.5 km", "3ft" or "4.2e3 mm"
+/// \details The number is parsed with std::from_chars, and so is locale independent.
+///	The suffix is mandatory, it may be separated from the number by spaces, and ends at the first space or at p_last.
+///	The value is converted to Unit_t with a single multiply and add, nothing is allocated.
+/// \param[out] p_out - only written on success
+/// \return on success ptr points past the suffix. On failure ec is std::errc::invalid_argument and ptr is p_first
+///		if the number or the suffix is malformed, or the suffix is not compatible with Unit_t,
+///		or the error reported by std::from_chars for the number.
+template<typename Unit_t> requires (_p::c_unit<Unit_t> || _p::c_offset_unit<Unit_t>)
+inline std::from_chars_result from_chars(const char* p_first, const char* p_last, Unit_t& p_out, std::chars_format p_format = std::chars_format::general)
+{
+	using value_t = typename Unit_t::value_t;
+
+	value_t t_value;
+	const std::from_chars_result t_number = std::from_chars(p_first, p_last, t_value, p_format);
+	if(t_number.ec != std::errc{})
+	{
+		return t_number;
+	}
+
+	const char* t_begin = t_number.ptr;
+	while(t_begin != p_last && *t_begin == ' ')
+	{
+		++t_begin;
+	}
+	const char* t_end = t_begin;
+	while(t_end != p_last && _p::is_unit_expression_char(*t_end))
+	{
+		++t_end;
+	}
+
+	affine_conversion t_conversion;
+	if(t_begin == t_end || parse_unit_conversion<Unit_t>(std::string_view{t_begin, static_cast<uintptr_t>(t_end - t_begin)}, t_conversion) != std::errc{})
+	{
+		return std::from_chars_result{p_first, std::errc::invalid_argument};
+	}
+
+	p_out = Unit_t{t_conversion.apply(t_value)};
+	return std::from_chars_result{t_end, std::errc{}};
+}
+
+} //namespace unit
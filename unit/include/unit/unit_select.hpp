@@ -0,0 +1,105 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "unit.hpp"
+
+namespace unit
+{
+
+namespace _p
+{
+	template<typename Unit_t, typename Source_t, typename Fn>
+	inline decltype(auto) visit_as_one(const Source_t& p_value, Fn& p_fn)
+	{
+		return p_fn(Unit_t{p_value});
+	}
+
+	template<typename Source_t, typename Fn, typename... Units>
+	using visit_as_result_t = std::invoke_result_t<Fn&, core::pack_get_t<core::pack<Units...>, 0>>;
+
+	template<typename Source_t, typename Fn, typename... Units>
+	concept c_visitable_as =
+		(c_unit<Source_t> || c_offset_unit<Source_t>) &&
+		sizeof...(Units) != 0 &&
+		(std::is_constructible_v<Units, const Source_t&> && ...) &&
+		(std::is_same_v<std::invoke_result_t<Fn&, Units>, visit_as_result_t<Source_t, Fn, Units...>> && ...);
+} //namespace _p
+
+
+/// \brief Calls p_fn with p_value converted to the unit selected at runtime from Units
+/// \param p_index - position of the selected unit in Units
+/// \details Each alternative is a statically typed conversion, they are reached through a constant table of functions
+///	with a single indirect call. p_fn must return the same type for every unit.
+/// \pre p_index < sizeof...(Units)
+template<typename... Units, typename Source_t, typename Fn> requires _p::c_visitable_as<Source_t, Fn, Units...>
+inline decltype(auto) visit_as(uintptr_t p_index, const Source_t& p_value, Fn&& p_fn)
+{
+	using result_t = _p::visit_as_result_t<Source_t, Fn, Units...>;
+	static constexpr std::array<result_t (*)(const Source_t&, Fn&), sizeof...(Units)> table{&_p::visit_as_one<Units, Source_t, Fn>...};
+	return table[p_index](p_value, p_fn);
+}
+
+
+/// \brief Factors that convert values of Source_t to each of Units
+/// \note Only units without offset, conversions between them are a single multiplication
+template<_p::c_unit Source_t, _p::c_unit... Units> requires (_p::c_compatible_unit_pack<typename Source_t::unit_pack, typename Units::unit_pack> && ...)
+inline constexpr std::array<typename Source_t::value_t, sizeof...(Units)> unit_factors_v
+{
+	_p::metric_conversion<typename Source_t::value_t, typename Units::unit_pack, typename Source_t::unit_pack>(typename Source_t::value_t{1})...
+};
+
+/// \brief Converts a batch of values to the unit selected at runtime from Units
+/// \param p_index - position of the selected unit in Units
+/// \param p_out - values in the selected unit
+/// \return false if p_index is out of range or p_out does not have the same size as p_values
+/// \note The factor is looked up once, the loop itself has no branches.
+template<_p::c_unit... Units, _p::c_unit Source_t> requires (_p::c_compatible_unit_pack<typename Source_t::unit_pack, typename Units::unit_pack> && ...)
+inline bool convert_as(uintptr_t p_index, std::span<const Source_t> p_values, std::span<typename Source_t::value_t> p_out)
+{
+	using value_t = typename Source_t::value_t;
+	constexpr std::array<value_t, sizeof...(Units)> factors = unit_factors_v<Source_t, Units...>;
+
+	if(p_index >= factors.size() || p_out.size() != p_values.size())
+	{
+		return false;
+	}
+
+	const value_t t_factor = factors[p_index];
+	for(uintptr_t i = 0; i < p_values.size(); ++i)
+	{
+		p_out[i] = p_values[i].value() * t_factor;
+	}
+	return true;
+}
+
+} //namespace unit
@@ -0,0 +1,433 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+/// \brief Module interface of the unit library, exports the same entities as unit/unit.hpp
+/// \note The headers remain the primary interface, this unit only re-exports them
+
+module;
+
+#include <unit/unit.hpp>
+#include <unit/standard/constants.hpp>
+#include <unit/standard/digital_prefix.hpp>
+#include <unit/standard/multipliers.hpp>
+#include <unit/standard/si_prefix.hpp>
+
+export module unit;
+
+export namespace core
+{
+	using core::pack;
+} //namespace core
+
+
+export namespace unit::_p
+{
+	using unit::_p::default_fp;
+
+	using unit::_p::Unit;
+	using unit::_p::Offset_Unit;
+	using unit::_p::unit_pack;
+	using unit::_p::dimension;
+	using unit::_p::scalar;
+
+	using unit::_p::metric_base_t;
+	using unit::_p::metric_id_v;
+
+	using unit::_p::c_ValidFP;
+	using unit::_p::c_metric_t;
+	using unit::_p::c_standard;
+	using unit::_p::c_proxy_property;
+	using unit::_p::c_dimension;
+	using unit::_p::c_scalar;
+	using unit::_p::c_unit_pack;
+	using unit::_p::conversion_kind;
+	using unit::_p::conversion_kind_v;
+	using unit::_p::c_compatible_unit_pack;
+	using unit::_p::c_interchangeable_unit_pack;
+	using unit::_p::c_weak_compatible_unit_pack;
+	using unit::_p::c_unit;
+	using unit::_p::c_offset_unit;
+
+	using unit::_p::is_unit;
+	using unit::_p::is_unit_v;
+	using unit::_p::is_offset_unit;
+	using unit::_p::is_offset_unit_v;
+
+	using unit::_p::metric_conversion;
+	using unit::_p::metric_multiply;
+	using unit::_p::metric_divide;
+	using unit::_p::op_result_t;
+
+	//free operators, found through argument dependent lookup
+	using unit::_p::operator *;
+	using unit::_p::operator /;
+} //namespace unit::_p
+
+
+export namespace unit::standard
+{
+	using unit::standard::SI_standard;
+
+	using unit::standard::angle_metric;
+	using unit::standard::angle_standard;
+	using unit::standard::arc_minute;
+	using unit::standard::arc_second;
+	using unit::standard::bit;
+	using unit::standard::byte;
+	using unit::standard::candela;
+	using unit::standard::celcius;
+	using unit::standard::charge_metric;
+	using unit::standard::charge_standard;
+	using unit::standard::coloumb;
+	using unit::standard::degree;
+	using unit::standard::digital_info_metric;
+	using unit::standard::digital_info_standard;
+	using unit::standard::doublet;
+	using unit::standard::fahrenheit;
+	using unit::standard::foot;
+	using unit::standard::grad;
+	using unit::standard::gram;
+	using unit::standard::hour;
+	using unit::standard::inch;
+	using unit::standard::kelvin;
+	using unit::standard::lenght_metric;
+	using unit::standard::lenght_standard;
+	using unit::standard::light_second;
+	using unit::standard::light_year;
+	using unit::standard::luminosity_metric;
+	using unit::standard::luminous_intensity_standard;
+	using unit::standard::mass_metric;
+	using unit::standard::mass_standard;
+	using unit::standard::metre;
+	using unit::standard::mile;
+	using unit::standard::minute;
+	using unit::standard::nautical_mile;
+	using unit::standard::octlet;
+	using unit::standard::ounce_av;
+	using unit::standard::pound_av;
+	using unit::standard::quadlet;
+	using unit::standard::radian;
+	using unit::standard::rankine;
+	using unit::standard::second;
+	using unit::standard::si_mass;
+	using unit::standard::temperature_metric;
+	using unit::standard::temperature_standard;
+	using unit::standard::time_metric;
+	using unit::standard::time_standard;
+	using unit::standard::turn;
+	using unit::standard::yard;
+
+	using unit::standard::avogadro_number;
+	using unit::standard::metric_speed_of_light;
+} //namespace unit::standard
+
+
+export namespace unit::multi
+{
+	using unit::multi::E;
+	using unit::multi::g0_si;
+	using unit::multi::g0_imp;
+	using unit::multi::bi;
+	using unit::multi::seconds_in_hour;
+	using unit::multi::inches_in_meter;
+	using unit::multi::yotta;
+	using unit::multi::zetta;
+	using unit::multi::exa;
+	using unit::multi::peta;
+	using unit::multi::tera;
+	using unit::multi::giga;
+	using unit::multi::mega;
+	using unit::multi::kilo;
+	using unit::multi::hecto;
+	using unit::multi::deca;
+	using unit::multi::deci;
+	using unit::multi::centi;
+	using unit::multi::milli;
+	using unit::multi::micro;
+	using unit::multi::nano;
+	using unit::multi::pico;
+	using unit::multi::femto;
+	using unit::multi::atto;
+	using unit::multi::zepto;
+	using unit::multi::yocto;
+	using unit::multi::yobi;
+	using unit::multi::zebi;
+	using unit::multi::exbi;
+	using unit::multi::pebi;
+	using unit::multi::tebi;
+	using unit::multi::gibi;
+	using unit::multi::mebi;
+	using unit::multi::kibi;
+} //namespace unit::multi
+
+
+export namespace unit
+{
+	using unit::make_unit;
+
+	//alias_acceleration.hpp
+	using unit::metre_per_second_squared_t;
+	using unit::foot_per_second_squared_t;
+	using unit::metre_per_second_squared;
+	using unit::foot_per_second_squared;
+
+	//alias_angle.hpp
+	using unit::radian_t;
+	using unit::grad_t;
+	using unit::degree_t;
+	using unit::arc_minute_t;
+	using unit::arc_second_t;
+	using unit::turn_t;
+	using unit::radian;
+	using unit::grad;
+	using unit::degree;
+	using unit::arc_minute;
+	using unit::arc_second;
+	using unit::turn;
+
+	//alias_angular_acceleration.hpp
+	using unit::radian_per_second_square_t;
+	using unit::turn_per_second_square_t;
+	using unit::radian_per_second_square;
+	using unit::turn_per_second_square;
+
+	//alias_angular_velocity.hpp
+	using unit::radians_per_second_t;
+	using unit::rotations_per_minute_t;
+	using unit::radians_per_second;
+	using unit::rotations_per_minute;
+
+	//alias_area.hpp
+	using unit::square_metre_t;
+	using unit::square_foot_t;
+	using unit::hectare_t;
+	using unit::acre_t;
+	using unit::square_mile_t;
+	using unit::square_kilo_metre_t;
+	using unit::square_metre;
+	using unit::square_foot;
+	using unit::hectare;
+	using unit::acre;
+	using unit::square_mile;
+	using unit::square_kilo_metre;
+
+	//alias_charge.hpp
+	using unit::coloumb_t;
+	using unit::amper_hour_t;
+	using unit::milli_amper_hour_t;
+	using unit::coloumb;
+	using unit::amper_hour;
+	using unit::milli_amper_hour;
+
+	//alias_density.hpp
+	using unit::kilogram_per_cubic_metre_t;
+	using unit::pound_av_per_cubic_feet_t;
+	using unit::kilogram_per_cubic_metre;
+	using unit::pound_av_per_cubic_feet;
+
+	//alias_digital.hpp
+	using unit::bit_t;
+	using unit::byte_t;
+	using unit::doublet_t;
+	using unit::quadlet_t;
+	using unit::octlet_t;
+	using unit::kibibyte_t;
+	using unit::mebibyte_t;
+	using unit::gibibyte_t;
+	using unit::tebibyte_t;
+	using unit::pebibyte_t;
+	using unit::bit;
+	using unit::byte;
+	using unit::doublet;
+	using unit::quadlet;
+	using unit::octlet;
+	using unit::kibibyte;
+	using unit::mebibyte;
+	using unit::gibibyte;
+	using unit::tebibyte;
+	using unit::pebibyte;
+
+	//alias_electrical.hpp
+	using unit::ampere_t;
+	using unit::volt_t;
+	using unit::ohm_t;
+	using unit::ampere;
+	using unit::volt;
+	using unit::ohm;
+
+	//alias_energy.hpp
+	using unit::joule_t;
+	using unit::watt_hour_t;
+	using unit::kilo_watt_hour_t;
+	using unit::joule;
+	using unit::watt_hour;
+	using unit::kilo_watt_hour;
+
+	//alias_flow_mass.hpp
+	using unit::kilogram_per_second_t;
+	using unit::pound_av_per_second_t;
+	using unit::kilogram_per_second;
+	using unit::pound_av_per_second;
+
+	//alias_flow_volume.hpp
+	using unit::cubic_metre_per_second_t;
+	using unit::cubic_foot_per_second_t;
+	using unit::cubic_metres_per_second;
+	using unit::cubic_foot_per_second;
+
+	//alias_force.hpp
+	using unit::newton_t;
+	using unit::kilogram_force_t;
+	using unit::pound_av_force_t;
+	using unit::poundal_t;
+	using unit::newton;
+	using unit::kilogram_force;
+	using unit::pound_av_force;
+	using unit::poundal;
+
+	//alias_lenght.hpp
+	using unit::metre_t;
+	using unit::foot_t;
+	using unit::inch_t;
+	using unit::yard_t;
+	using unit::mile_t;
+	using unit::nautical_mile_t;
+	using unit::light_second_t;
+	using unit::light_year_t;
+	using unit::nano_metre_t;
+	using unit::micro_metre_t;
+	using unit::milli_metre_t;
+	using unit::centi_metre_t;
+	using unit::kilo_metre_t;
+	using unit::metre;
+	using unit::foot;
+	using unit::inch;
+	using unit::yard;
+	using unit::mile;
+	using unit::nautical_mile;
+	using unit::light_second;
+	using unit::light_year;
+	using unit::nano_metre;
+	using unit::micro_metre;
+	using unit::milli_metre;
+	using unit::centi_metre;
+	using unit::kilo_metre;
+
+	//alias_luminosity.hpp
+	using unit::candela_t;
+	using unit::candela;
+
+	//alias_mass.hpp
+	using unit::kilogram_t;
+	using unit::gram_t;
+	using unit::pound_av_t;
+	using unit::ounce_av_t;
+	using unit::tonne_t;
+	using unit::kilogram;
+	using unit::gram;
+	using unit::pound_av;
+	using unit::ounce_av;
+	using unit::tonne;
+
+	//alias_power.hpp
+	using unit::watt_t;
+	using unit::watt;
+
+	//alias_pressure.hpp
+	using unit::pascal_t;
+	using unit::kilopascal_t;
+	using unit::bar_t;
+	using unit::pound_av_force_per_square_inch_t;
+	using unit::inch_mercury32_t;
+	using unit::inch_mercury60_t;
+	using unit::inch_mercury_t;
+	using unit::atmosphere_t;
+	using unit::poundal_per_square_foot_t;
+	using unit::pascal;
+	using unit::kilopascal;
+	using unit::bar;
+	using unit::pound_av_force_per_square_inch;
+	using unit::inch_mercury32;
+	using unit::inch_mercury60;
+	using unit::inch_mercury;
+	using unit::atmosphere;
+	using unit::poundal_per_square_foot;
+
+	//alias_temperature.hpp
+	using unit::kelvin_t;
+	using unit::rankine_t;
+	using unit::celcius_t;
+	using unit::fahrenheit_t;
+	using unit::kelvin;
+	using unit::rankine;
+	using unit::celcius;
+	using unit::fahrenheit;
+
+	//alias_time.hpp
+	using unit::second_t;
+	using unit::minute_t;
+	using unit::hour_t;
+	using unit::nano_second_t;
+	using unit::micro_second_t;
+	using unit::milli_second_t;
+	using unit::hertz_t;
+	using unit::second;
+	using unit::minute;
+	using unit::hour;
+	using unit::nano_second;
+	using unit::micro_second;
+	using unit::milli_second;
+	using unit::hertz;
+
+	//alias_torque.hpp
+	using unit::newton_metre_t;
+	using unit::pound_av_force_foot_t;
+	using unit::newton_metre;
+	using unit::pound_av_force_foot;
+
+	//alias_velocity.hpp
+	using unit::metre_per_second_t;
+	using unit::foot_per_second_t;
+	using unit::kilometre_per_hour_t;
+	using unit::mile_per_hour_t;
+	using unit::knot_t;
+	using unit::metre_per_second;
+	using unit::foot_per_second;
+	using unit::kilometre_per_hour;
+	using unit::mile_per_hour;
+	using unit::knot;
+
+	//alias_volume.hpp
+	using unit::cubic_metre_t;
+	using unit::litre_t;
+	using unit::cubic_foot_t;
+	using unit::gallon_t;
+	using unit::pint_t;
+	using unit::cubic_metre;
+	using unit::litre;
+	using unit::cubic_foot;
+	using unit::gallon;
+	using unit::pint;
+} //namespace unit
@@ -0,0 +1,122 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <array>
+#include <string_view>
+#include <type_traits>
+
+#include <unit/any_unit.hpp>
+#include <unit/alias_lenght.hpp>
+#include <unit/alias_temperature.hpp>
+#include <unit/alias_time.hpp>
+#include <unit/alias_velocity.hpp>
+
+#include "test_utils.hpp"
+
+namespace unit
+{
+
+TEST(any_unit, storage)
+{
+	static_assert(std::is_trivially_copyable_v<any_unit>);
+	static_assert(sizeof(any_unit) <= 2 * sizeof(long double));
+
+	any_unit t_empty;
+	ASSERT_FALSE(t_empty.has_value());
+	ASSERT_FALSE(any_cast<metre>(t_empty).has_value());
+	ASSERT_FALSE(t_empty.to<metre>().has_value());
+
+	any_unit t_any = foot{2.0};
+	ASSERT_TRUE(t_any.has_value());
+	ASSERT_EQ(t_any.fingerprint(), _p::unit_fingerprint_v<foot>);
+	ASSERT_EQ(t_any.descriptor(), unit_descriptor_v<foot>);
+
+	t_any.reset();
+	ASSERT_FALSE(t_any.has_value());
+}
+
+TEST(any_unit, any_cast)
+{
+	const any_unit t_any = metre{3.0};
+
+	const std::optional<metre> t_metre = any_cast<metre>(t_any);
+	ASSERT_TRUE(t_metre.has_value());
+	ASSERT_EQ(t_metre->value(), 3.0);
+
+	//no conversion through any_cast
+	ASSERT_FALSE(any_cast<foot>(t_any).has_value());
+	ASSERT_FALSE(any_cast<metre_t<float>>(t_any).has_value());
+	ASSERT_FALSE(any_cast<second>(t_any).has_value());
+
+	static_assert(_p::unit_fingerprint_v<metre> != _p::unit_fingerprint_v<foot>);
+	static_assert(_p::unit_fingerprint_v<metre> != _p::unit_fingerprint_v<metre_t<float>>);
+	static_assert(_p::unit_fingerprint_v<kelvin> != _p::unit_fingerprint_v<celcius>);
+
+	const any_unit t_temperature = celcius{20.0};
+	ASSERT_TRUE(any_cast<celcius>(t_temperature).has_value());
+	ASSERT_FALSE(any_cast<kelvin>(t_temperature).has_value());
+}
+
+TEST(any_unit, conversion)
+{
+	const any_unit t_any = celcius{100.0};
+	ASSERT_TRUE(t_any.compatible(unit_descriptor_v<fahrenheit>));
+	ASSERT_TRUE(t_any.compatible(any_unit{kelvin{1.0}}));
+	ASSERT_FALSE(t_any.compatible(any_unit{metre{1.0}}));
+	ASSERT_FALSE(t_any.compatible(any_unit{}));
+
+	const std::optional<fahrenheit> t_fahrenheit = t_any.to<fahrenheit>();
+	ASSERT_TRUE(t_fahrenheit.has_value());
+	ASSERT_TRUE(closeEnough(t_fahrenheit->value(), 212.0, 1e-9));
+	ASSERT_TRUE(closeEnough(t_any.to<kelvin>()->value(), 373.15, 1e-9));
+	ASSERT_FALSE(t_any.to<metre>().has_value());
+
+	const any_unit t_speed = kilometre_per_hour{36.0};
+	ASSERT_TRUE(closeEnough(t_speed.to<metre_per_second>()->value(), 10.0, 1e-12));
+	ASSERT_TRUE(closeEnough(t_speed.to<metre_per_second_t<float>>()->value(), 10.0f, 1e-5f));
+}
+
+TEST(any_unit, to_chars)
+{
+	std::array<char, 64> t_buffer;
+	const auto format = [&t_buffer](const any_unit& p_any, auto... p_args)
+		{
+			const std::to_chars_result t_result = to_chars(t_buffer.data(), t_buffer.data() + t_buffer.size(), p_any, p_args...);
+			EXPECT_EQ(t_result.ec, std::errc{});
+			return std::string_view{t_buffer.data(), static_cast<uintptr_t>(t_result.ptr - t_buffer.data())};
+		};
+
+	ASSERT_EQ(format(metre{1.5}), "1.5 m");
+	ASSERT_EQ(format(kilometre_per_hour{3.14159}, std::chars_format::fixed, 2), "3.14 km/h");
+	ASSERT_EQ(format(celcius{21.5}, std::chars_format::fixed, 1), "21.5 degC");
+	ASSERT_EQ(format(second{1500.0}, std::chars_format::scientific), "1.5e+03 s");
+
+	ASSERT_EQ(to_chars(t_buffer.data(), t_buffer.data() + t_buffer.size(), any_unit{}).ec, std::errc::invalid_argument);
+}
+
+} //namespace unit
@@ -0,0 +1,137 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <array>
+#include <thread>
+#include <vector>
+
+#include <unit/conversion_cache.hpp>
+#include <unit/alias_lenght.hpp>
+#include <unit/alias_temperature.hpp>
+#include <unit/alias_time.hpp>
+
+#include "test_utils.hpp"
+
+namespace unit
+{
+
+TEST(conversion_cache, lookup)
+{
+	conversion_cache<64> cache;
+	constexpr unit_descriptor celcius_d		= unit_descriptor_v<celcius>;
+	constexpr unit_descriptor fahrenheit_d	= unit_descriptor_v<fahrenheit>;
+	constexpr unit_descriptor kelvin_d		= unit_descriptor_v<kelvin>;
+
+	ASSERT_FALSE(cache.find(celcius_d, fahrenheit_d).has_value());
+
+	const std::optional<double> t_boiling = cache.convert(100.0, celcius_d, fahrenheit_d);
+	ASSERT_TRUE(t_boiling.has_value());
+	ASSERT_TRUE(closeEnough(*t_boiling, 212.0, 1e-9));
+
+	const std::optional<affine_conversion> c_to_f = cache.find(celcius_d, fahrenheit_d);
+	ASSERT_TRUE(c_to_f.has_value());
+	ASSERT_TRUE(closeEnough(c_to_f->apply(-40.0), -40.0, 1e-9));
+
+	//direction is part of the key
+	ASSERT_FALSE(cache.find(fahrenheit_d, celcius_d).has_value());
+	ASSERT_TRUE(closeEnough(*cache.convert(32.0, fahrenheit_d, celcius_d), 0.0, 1e-9));
+	ASSERT_TRUE(closeEnough(*cache.convert(0.0, celcius_d, kelvin_d), 273.15, 1e-9));
+
+	//incompatible units are never cached
+	ASSERT_FALSE(cache.convert(1.0, unit_descriptor_v<metre>, celcius_d).has_value());
+	ASSERT_FALSE(cache.find(unit_descriptor_v<metre>, celcius_d).has_value());
+}
+
+TEST(conversion_cache, bounded)
+{
+	//more pairs than slots, older entries get replaced but results stay correct
+	conversion_cache<4> cache;
+	const std::array<unit_descriptor, 4> t_lenghts
+	{
+		unit_descriptor_v<metre>,
+		unit_descriptor_v<foot>,
+		unit_descriptor_v<inch>,
+		unit_descriptor_v<kilo_metre>
+	};
+
+	for(uint32_t t_round = 0; t_round < 3; ++t_round)
+	{
+		for(const unit_descriptor& t_from : t_lenghts)
+		{
+			for(const unit_descriptor& t_to : t_lenghts)
+			{
+				const std::optional<double> t_result = cache.convert(2.0, t_from, t_to);
+				ASSERT_TRUE(t_result.has_value());
+				ASSERT_TRUE(closeEnough(*t_result, 2.0 * t_from.gauge() / t_to.gauge(), 1e-12));
+			}
+		}
+	}
+}
+
+TEST(conversion_cache, concurrent)
+{
+	conversion_cache<8> cache;
+	const std::array<unit_descriptor, 4> t_units
+	{
+		unit_descriptor_v<celcius>,
+		unit_descriptor_v<fahrenheit>,
+		unit_descriptor_v<kelvin>,
+		unit_descriptor_v<rankine>
+	};
+
+	std::vector<std::thread> t_workers;
+	std::array<bool, 4> t_ok{};
+	for(uintptr_t t_worker = 0; t_worker < t_ok.size(); ++t_worker)
+	{
+		t_workers.emplace_back(
+			[&cache, &t_units, &t_ok, t_worker]()
+			{
+				bool t_good = true;
+				for(uint32_t i = 0; i < 10000; ++i)
+				{
+					const unit_descriptor& t_from	= t_units[(i + t_worker) % t_units.size()];
+					const unit_descriptor& t_to		= t_units[(i / t_units.size()) % t_units.size()];
+					const std::optional<affine_conversion> t_expected = make_conversion(t_from, t_to);
+					const std::optional<double> t_result = cache.convert(300.0, t_from, t_to);
+					t_good = t_good && t_result.has_value() && closeEnough(*t_result, t_expected->apply(300.0), 1e-9);
+				}
+				t_ok[t_worker] = t_good;
+			});
+	}
+	for(std::thread& t_thread : t_workers)
+	{
+		t_thread.join();
+	}
+
+	for(bool t_good : t_ok)
+	{
+		ASSERT_TRUE(t_good);
+	}
+}
+
+} //namespace unit
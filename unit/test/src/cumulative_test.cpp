@@ -0,0 +1,116 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <type_traits>
+#include <vector>
+
+#include <unit/cumulative.hpp>
+#include <unit/alias_energy.hpp>
+#include <unit/alias_lenght.hpp>
+#include <unit/alias_power.hpp>
+#include <unit/alias_time.hpp>
+#include <unit/alias_velocity.hpp>
+
+#include "test_utils.hpp"
+
+namespace unit
+{
+
+TEST(cumulative, result_type)
+{
+	ASSERT_TRUE((std::is_same_v<integral_t<metre_per_second, second>, metre>));
+	ASSERT_TRUE((std::is_same_v<integral_t<watt, second>, joule>));
+}
+
+TEST(cumulative, scan)
+{
+	parallel::thread_pool pool{4};
+
+	for(const uint32_t t_size: {0u, 1u, 7u, 8u, 9u, 1000u, 100003u})
+	{
+		std::vector<metre> t_in;
+		for(uint32_t i = 0; i < t_size; ++i)
+		{
+			t_in.emplace_back(static_cast<double>(i % 13));
+		}
+
+		std::vector<metre> t_inclusive(t_size);
+		std::vector<metre> t_exclusive(t_size);
+		parallel::scan(t_in, t_inclusive, std::plus<>{}, 1000, pool);
+		parallel::exclusive_scan(t_in, t_exclusive, 1000, pool);
+
+		double t_sum = 0.0;
+		for(uint32_t i = 0; i < t_size; ++i)
+		{
+			ASSERT_EQ(t_exclusive[i].value(), t_sum) << "Size: " << t_size << " Index: " << i;
+			t_sum += t_in[i].value();
+			ASSERT_EQ(t_inclusive[i].value(), t_sum) << "Size: " << t_size << " Index: " << i;
+		}
+
+		//in place
+		parallel::scan(t_in, t_in, std::plus<>{}, 1000, pool);
+		for(uint32_t i = 0; i < t_size; ++i)
+		{
+			ASSERT_EQ(t_in[i].value(), t_inclusive[i].value());
+		}
+	}
+}
+
+TEST(cumulative, trapezoid)
+{
+	parallel::thread_pool pool{3};
+	constexpr uint32_t sample_count = 5001;
+
+	std::vector<metre_per_second> t_speed;
+	std::vector<second> t_time;
+	for(uint32_t i = 0; i < sample_count; ++i)
+	{
+		const double t = static_cast<double>(i) * 0.5;
+		t_time.emplace_back(t);
+		t_speed.emplace_back(2.0 * t);
+	}
+
+	//integral of 2t is t^2, exact for trapezoids of a linear function
+	std::vector<metre> t_distance(sample_count);
+	parallel::cumulative_trapezoid(t_speed, t_time, t_distance, 256, pool);
+	for(uint32_t i = 0; i < sample_count; ++i)
+	{
+		const double t = static_cast<double>(i) * 0.5;
+		ASSERT_TRUE(closeEnough(t_distance[i].value(), t * t, 1e-9 * (1.0 + t * t))) << "Index: " << i;
+	}
+
+	std::vector<joule> t_energy(4);
+	const std::vector<watt> t_power{watt{1.0}, watt{3.0}, watt{3.0}, watt{1.0}};
+	parallel::cumulative_trapezoid(t_power, second{0.5}, t_energy, 256, pool);
+	ASSERT_EQ(t_energy[0].value(), 0.0);
+	ASSERT_TRUE(closeEnough(t_energy[1].value(), 1.0, 1e-12));
+	ASSERT_TRUE(closeEnough(t_energy[2].value(), 2.5, 1e-12));
+	ASSERT_TRUE(closeEnough(t_energy[3].value(), 3.5, 1e-12));
+}
+
+} //namespace unit
@@ -0,0 +1,136 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <array>
+#include <vector>
+
+#include <unit/dynamic_column.hpp>
+#include <unit/alias_lenght.hpp>
+#include <unit/alias_temperature.hpp>
+#include <unit/alias_time.hpp>
+#include <unit/alias_velocity.hpp>
+
+#include "test_utils.hpp"
+
+namespace unit
+{
+
+TEST(dynamic_column, descriptor)
+{
+	constexpr unit_descriptor metre_d		= unit_descriptor_v<metre>;
+	constexpr unit_descriptor foot_d		= unit_descriptor_v<foot>;
+	constexpr unit_descriptor celcius_d		= unit_descriptor_v<celcius>;
+	constexpr unit_descriptor fahrenheit_d	= unit_descriptor_v<fahrenheit>;
+
+	ASSERT_TRUE(metre_d.compatible(foot_d));
+	ASSERT_FALSE(metre_d.compatible(celcius_d));
+	ASSERT_TRUE(celcius_d.has_offset());
+	ASSERT_FALSE(metre_d.multiply(celcius_d).has_value());
+	ASSERT_EQ(metre_d.divide(unit_descriptor_v<second>)->signature(), unit_descriptor_v<metre_per_second>.signature());
+
+	const std::optional<affine_conversion> foot_to_metre = make_conversion(foot_d, metre_d);
+	ASSERT_TRUE(foot_to_metre.has_value());
+	ASSERT_TRUE(closeEnough(foot_to_metre->apply(10.0), 3.048, 1e-12));
+
+	const std::optional<affine_conversion> c_to_f = make_conversion(celcius_d, fahrenheit_d);
+	ASSERT_TRUE(c_to_f.has_value());
+	ASSERT_TRUE(closeEnough(c_to_f->apply(100.0), 212.0, 1e-9));
+	ASSERT_TRUE(closeEnough(c_to_f->apply(-40.0), -40.0, 1e-9));
+
+	const std::optional<affine_conversion> c_to_k = make_conversion(celcius_d, unit_descriptor_v<kelvin>);
+	ASSERT_TRUE(c_to_k.has_value());
+	ASSERT_TRUE(closeEnough(c_to_k->apply(0.0), 273.15, 1e-9));
+
+	ASSERT_FALSE(make_conversion(metre_d, unit_descriptor_v<second>).has_value());
+}
+
+TEST(dynamic_column, arithmetic)
+{
+	const dynamic_column<double> distance{unit_descriptor_v<kilo_metre>, {1.0, 2.0, 3.0, 4.0, 5.0}};
+	const dynamic_column<double> extra{unit_descriptor_v<metre>, {100.0, 200.0, 300.0, 400.0, 500.0}};
+	const dynamic_column<double> duration{unit_descriptor_v<hour>, {1.0, 2.0, 3.0, 4.0, 5.0}};
+
+	const std::optional<dynamic_column<double>> total = distance.add(extra);
+	ASSERT_TRUE(total.has_value());
+	ASSERT_EQ(total->descriptor(), distance.descriptor());
+	for(uintptr_t i = 0; i < total->size(); ++i)
+	{
+		ASSERT_TRUE(closeEnough((*total)[i], 1.1 * static_cast<double>(i + 1), 1e-12)) << "Index: " << i;
+	}
+
+	const std::optional<dynamic_column<double>> remaining = distance.subtract(extra);
+	ASSERT_TRUE(remaining.has_value());
+	ASSERT_TRUE(closeEnough((*remaining)[4], 4.5, 1e-12));
+
+	const std::optional<dynamic_column<double>> speed = total->divide(duration);
+	ASSERT_TRUE(speed.has_value());
+	ASSERT_TRUE(speed->descriptor().compatible(unit_descriptor_v<metre_per_second>));
+
+	std::array<kilometre_per_hour, 5> as_static;
+	ASSERT_TRUE(speed->copy_to(std::span<kilometre_per_hour>{as_static}));
+	for(const kilometre_per_hour& value: as_static)
+	{
+		ASSERT_TRUE(closeEnough(value.value(), 1.1, 1e-12));
+	}
+
+	const std::optional<dynamic_column<double>> area = distance.multiply(extra);
+	ASSERT_TRUE(area.has_value());
+	ASSERT_EQ(area->descriptor().signature().rank(_p::dynamic_lane_v<standard::lenght_metric>), 2);
+
+	ASSERT_FALSE(distance.add(duration).has_value());
+	ASSERT_FALSE(distance.add(dynamic_column<double>{unit_descriptor_v<metre>, {1.0}}).has_value());
+
+	std::array<second, 5> wrong;
+	ASSERT_FALSE(distance.copy_to(std::span<second>{wrong}));
+}
+
+TEST(dynamic_column, convert)
+{
+	dynamic_column<double> temperature{unit_descriptor_v<celcius>, {0.0, 100.0, -40.0}};
+
+	ASSERT_FALSE(temperature.convert_to(unit_descriptor_v<metre>));
+	ASSERT_EQ(temperature.descriptor(), unit_descriptor_v<celcius>);
+
+	ASSERT_TRUE(temperature.convert_to(unit_descriptor_v<fahrenheit>));
+	ASSERT_TRUE(closeEnough(temperature[0], 32.0, 1e-9));
+	ASSERT_TRUE(closeEnough(temperature[1], 212.0, 1e-9));
+	ASSERT_TRUE(closeEnough(temperature[2], -40.0, 1e-9));
+
+	std::array<celcius, 3> as_static;
+	ASSERT_TRUE(temperature.copy_to(std::span<celcius>{as_static}));
+	ASSERT_TRUE(closeEnough(as_static[1].value(), 100.0, 1e-9));
+
+	//adding a difference to an offset unit is allowed, adding 2 offset units is not
+	const dynamic_column<double> delta{unit_descriptor_v<rankine>, {9.0, 9.0, 9.0}};
+	const std::optional<dynamic_column<double>> warmer = temperature.add(delta);
+	ASSERT_TRUE(warmer.has_value());
+	ASSERT_TRUE(closeEnough((*warmer)[0], 41.0, 1e-9));
+	ASSERT_FALSE(delta.add(temperature).has_value());
+}
+
+} //namespace unit
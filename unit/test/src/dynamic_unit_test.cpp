@@ -0,0 +1,118 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <unit/dynamic_unit.hpp>
+#include <unit/alias_lenght.hpp>
+#include <unit/alias_mass.hpp>
+#include <unit/alias_time.hpp>
+#include <unit/alias_velocity.hpp>
+
+#include "test_utils.hpp"
+
+namespace unit
+{
+
+TEST(dynamic_unit, signature)
+{
+	using _p::dynamic_signature;
+	using _p::dynamic_lane_v;
+
+	constexpr uint8_t lenght	= dynamic_lane_v<standard::lenght_metric>;
+	constexpr uint8_t time		= dynamic_lane_v<standard::time_metric>;
+	constexpr uint8_t mass		= dynamic_lane_v<standard::mass_metric>;
+
+	const dynamic_signature metre_sig	= dynamic_signature::from_rank(lenght, 1);
+	const dynamic_signature second_sig	= dynamic_signature::from_rank(time, 1);
+
+	//m/s^2, negative ranks must not borrow from neighbouring lanes
+	const dynamic_signature accel = metre_sig / second_sig / second_sig;
+	ASSERT_EQ(accel.rank(lenght), 1);
+	ASSERT_EQ(accel.rank(time), -2);
+	ASSERT_EQ(accel.rank(mass), 0);
+	ASSERT_EQ(accel.rank(dynamic_lane_v<standard::temperature_metric>), 0);
+
+	ASSERT_EQ(accel * second_sig * second_sig, metre_sig);
+	ASSERT_TRUE((accel / accel).dimensionless());
+	ASSERT_EQ(accel.inverse().rank(lenght), -1);
+	ASSERT_EQ(accel.inverse().rank(time), 2);
+
+	for(uint8_t lane = 0; lane < _p::dynamic_lane_count; ++lane)
+	{
+		const dynamic_signature low = dynamic_signature::from_rank(lane, -128);
+		const dynamic_signature high = dynamic_signature::from_rank(lane, 127);
+		ASSERT_EQ((low * high).rank(lane), -1) << int{lane};
+		ASSERT_EQ((high / high).word(), 0) << int{lane};
+		ASSERT_EQ((low / dynamic_signature::from_rank(lane, 1)).rank(lane), 127) << int{lane};
+	}
+
+	ASSERT_EQ(_p::dynamic_signature_v<metre_per_second::unit_pack>, metre_sig / second_sig);
+	ASSERT_EQ(_p::dynamic_signature_v<foot_per_second::unit_pack>, metre_sig / second_sig);
+}
+
+TEST(dynamic_unit, arithmetic)
+{
+	const dynamic_unit<double> distance{kilo_metre{3.0}};
+	const dynamic_unit<double> duration{minute{2.0}};
+
+	const dynamic_unit<double> speed = distance / duration;
+	ASSERT_EQ(speed.signature(), _p::dynamic_signature_v<metre_per_second::unit_pack>);
+	ASSERT_TRUE(closeEnough(speed.standard_value(), 25.0, 1e-12));
+
+	const dynamic_unit<double> doubled = 2 * speed;
+	ASSERT_TRUE(closeEnough(doubled.standard_value(), 50.0, 1e-12));
+
+	const std::optional<dynamic_unit<double>> sum = distance.add(dynamic_unit<double>{metre{500.0}});
+	ASSERT_TRUE(sum.has_value());
+	ASSERT_EQ(sum->scale(), distance.scale());
+	ASSERT_TRUE(closeEnough(sum->value(), 3.5, 1e-12));
+
+	const std::optional<dynamic_unit<double>> difference = distance.subtract(dynamic_unit<double>{metre{500.0}});
+	ASSERT_TRUE(difference.has_value());
+	ASSERT_TRUE(closeEnough(difference->value(), 2.5, 1e-12));
+
+	ASSERT_FALSE(distance.add(duration).has_value());
+	ASSERT_FALSE(distance.compatible(speed));
+}
+
+TEST(dynamic_unit, static_bridge)
+{
+	const dynamic_unit<double> speed{kilometre_per_hour{36.0}};
+
+	const std::optional<metre_per_second> as_si = speed.to_unit<metre_per_second>();
+	ASSERT_TRUE(as_si.has_value());
+	ASSERT_TRUE(closeEnough(as_si->value(), 10.0, 1e-12));
+
+	const std::optional<kilometre_per_hour> same = speed.to_unit<kilometre_per_hour>();
+	ASSERT_TRUE(same.has_value());
+	ASSERT_EQ(same->value(), 36.0);
+
+	ASSERT_FALSE(speed.to_unit<metre>().has_value());
+	ASSERT_FALSE(speed.to_unit<kilogram>().has_value());
+}
+
+} //namespace unit
@@ -0,0 +1,103 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <vector>
+
+#include <unit/generator.hpp>
+#include <unit/alias_temperature.hpp>
+
+#include "test_utils.hpp"
+
+namespace unit
+{
+
+TEST(generator, pipeline)
+{
+	std::vector<kelvin> t_samples;
+	for(uint32_t i = 0; i < 103; ++i)
+	{
+		t_samples.emplace_back(static_cast<double>(i));
+	}
+
+	std::vector<rankine> t_result;
+	uintptr_t t_largest_chunk = 0;
+
+	stream::sink(
+		stream::convert<rankine>(
+			stream::filter(
+				stream::source(std::span<const kelvin>{t_samples}, 10),
+				[](const kelvin& p_val) { return p_val.value() >= 50.0; })),
+		[&](std::span<const rankine> p_chunk)
+		{
+			t_largest_chunk = std::max<uintptr_t>(t_largest_chunk, p_chunk.size());
+			t_result.insert(t_result.end(), p_chunk.begin(), p_chunk.end());
+		});
+
+	ASSERT_EQ(t_largest_chunk, uintptr_t{10});
+	ASSERT_EQ(t_result.size(), uintptr_t{53});
+	for(uintptr_t i = 0; i < t_result.size(); ++i)
+	{
+		const rankine expected{kelvin{static_cast<double>(i + 50)}};
+		ASSERT_TRUE(binarySame(t_result[i].value(), expected.value())) << "Index: " << i;
+	}
+}
+
+TEST(generator, reader_source)
+{
+	uint32_t t_next = 0;
+	auto t_reader = [&](std::span<celcius> p_buffer) -> uintptr_t
+	{
+		uintptr_t t_count = 0;
+		for(; t_count < p_buffer.size() && t_next < 25; ++t_count)
+		{
+			p_buffer[t_count] = celcius{static_cast<double>(t_next++)};
+		}
+		return t_count;
+	};
+
+	generator<celcius> t_input = stream::source<celcius>(t_reader, 8);
+	generator<kelvin> t_converted = stream::convert<kelvin>(std::move(t_input));
+
+	uintptr_t t_chunks = 0;
+	uintptr_t t_total = 0;
+	while(t_converted.next())
+	{
+		const std::span<const kelvin> t_chunk = t_converted.chunk();
+		for(uintptr_t i = 0; i < t_chunk.size(); ++i)
+		{
+			ASSERT_TRUE(closeEnough(t_chunk[i].value(), static_cast<double>(t_total + i) + 273.15, 1e-9));
+		}
+		t_total += t_chunk.size();
+		++t_chunks;
+	}
+	ASSERT_EQ(t_chunks, uintptr_t{4});
+	ASSERT_EQ(t_total, uintptr_t{25});
+	ASSERT_FALSE(t_converted.next());
+}
+
+} //namespace unit
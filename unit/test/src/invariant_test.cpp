@@ -36,6 +36,7 @@
 #include <unit/alias_angle.hpp>
 #include <unit/alias_area.hpp>
 #include <unit/alias_pressure.hpp>
+#include <unit/standard/multipliers.hpp>
 
 #include "test_utils.hpp"
 
@@ -311,4 +312,35 @@ TYPED_TEST(Invariant_T, compare)
 	}
 }
 
+TEST(make_unit, order_independent)
+{
+	using dim_metre		= _p::dimension<standard::metre, 1>;
+	using dim_second	= _p::dimension<standard::second, -2>;
+	using dim_kilogram	= _p::dimension<standard::si_mass, 1>;
+
+	using reference_t = make_unit<double, core::pack<dim_kilogram, dim_metre, dim_second>, core::pack<multi::kilo<1>, _p::scalar<multi::bi, 10>>>::type;
+
+	ASSERT_TRUE((std::is_same_v<reference_t, make_unit<double, core::pack<dim_second, dim_metre, dim_kilogram>, core::pack<_p::scalar<multi::bi, 10>, multi::kilo<1>>>::type>));
+	ASSERT_TRUE((std::is_same_v<reference_t, make_unit<double, core::pack<dim_metre, dim_second, dim_kilogram>, core::pack<multi::kilo<1>, _p::scalar<multi::bi, 10>>>::type>));
+	ASSERT_TRUE((std::is_same_v<reference_t, make_unit<double, core::pack<dim_second, dim_kilogram, dim_metre>, core::pack<_p::scalar<multi::bi, 10>, multi::kilo<1>>>::type>));
+	ASSERT_TRUE((std::is_same_v<make_unit<double, core::pack<>, core::pack<>>::type::unit_pack, _p::unit_pack<core::pack<>, core::pack<>>>));
+}
+
+TEST(utils, cpow)
+{
+	ASSERT_EQ(_p::cpow(10.l, 0), 1.l);
+	ASSERT_EQ(_p::cpow(10.l, 3), 1000.l);
+	ASSERT_EQ(_p::cpow(10.l, 24), 1e24l);
+	ASSERT_EQ(_p::cpow(10.l, -24), 1e-24l);
+	ASSERT_EQ(_p::cpow(10.l, -3), 1e-3l);
+	ASSERT_EQ(_p::cpow(2.l, 80), 1208925819614629174706176.l);
+	ASSERT_EQ(_p::cpow(2.l, -10), 1.l / 1024.l);
+	ASSERT_EQ(_p::cpow(3.l, 5), 243.l);
+	ASSERT_EQ(_p::cpow(-2.l, 3), -8.l);
+	ASSERT_EQ(_p::cpow(0.5l, -2), 4.l);
+
+	ASSERT_EQ((multi::yotta<1>::factor), 1e24l);
+	ASSERT_EQ((multi::yocto<1>::factor), 1e-24l);
+}
+
 } //namespace unit
@@ -0,0 +1,146 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <unit/parallel.hpp>
+#include <unit/alias_temperature.hpp>
+#include <unit/alias_pressure.hpp>
+
+#include "test_utils.hpp"
+
+namespace unit
+{
+
+TEST(parallel, thread_pool)
+{
+	parallel::thread_pool pool{4};
+	ASSERT_EQ(pool.size(), uintptr_t{4});
+
+	std::atomic<uint32_t> t_mask{0};
+	std::atomic<uint32_t> t_nested{0};
+	auto t_task = [&](uintptr_t p_worker)
+	{
+		t_mask.fetch_or(uint32_t{1} << p_worker);
+		auto t_inner = [&](uintptr_t) { t_nested.fetch_add(1); };
+		pool.run(t_inner);
+	};
+	pool.run(t_task);
+
+	ASSERT_EQ(t_mask.load(), uint32_t{0xF});
+	ASSERT_EQ(t_nested.load(), uint32_t{16});
+}
+
+TEST(parallel, thread_pool_nested_other)
+{
+	//a run() on a different pool from inside a job is not serialized
+	parallel::thread_pool outer{2};
+	parallel::thread_pool inner{2};
+
+	std::atomic<uint32_t> t_dispatched{0};
+	auto t_task = [&](uintptr_t)
+	{
+		const std::thread::id t_caller = std::this_thread::get_id();
+		auto t_inner = [&](uintptr_t p_worker)
+		{
+			if(p_worker == 1 && std::this_thread::get_id() != t_caller)
+			{
+				t_dispatched.fetch_add(1);
+			}
+		};
+		inner.run(t_inner);
+	};
+	outer.run(t_task);
+
+	ASSERT_EQ(t_dispatched.load(), uint32_t{2});
+}
+
+TEST(parallel, convert)
+{
+	parallel::thread_pool pool{4};
+
+	std::vector<kelvin> t_in;
+	for(uint32_t i = 0; i < 100003; ++i)
+	{
+		t_in.emplace_back(static_cast<double>(i) * 0.25);
+	}
+
+	std::vector<rankine> t_out(t_in.size());
+	parallel::convert(t_in, t_out, 1000, pool);
+
+	for(uintptr_t i = 0; i < t_in.size(); ++i)
+	{
+		const rankine expected{t_in[i]};
+		ASSERT_TRUE(binarySame(t_out[i].value(), expected.value())) << "Index: " << i;
+	}
+
+	std::vector<bar> t_transformed(t_in.size());
+	parallel::transform(t_in, t_transformed, [](kelvin p_val) { return bar{p_val.value()}; }, 777, pool);
+	for(uintptr_t i = 0; i < t_in.size(); ++i)
+	{
+		ASSERT_TRUE(binarySame(t_transformed[i].value(), t_in[i].value())) << "Index: " << i;
+	}
+}
+
+TEST(parallel, reduce_scan)
+{
+	parallel::thread_pool pool{3};
+
+	std::vector<pascal> t_in;
+	for(uint32_t i = 0; i < 50000; ++i)
+	{
+		t_in.emplace_back(static_cast<double>(i % 17));
+	}
+
+	std::vector<pascal> t_expected(t_in.size());
+	pascal t_sum{0.0};
+	for(uintptr_t i = 0; i < t_in.size(); ++i)
+	{
+		t_sum += t_in[i];
+		t_expected[i] = t_sum;
+	}
+
+	const pascal t_reduced = parallel::reduce(t_in, pascal{1.0}, std::plus<>{}, 512, pool);
+	ASSERT_EQ(t_reduced.value(), t_sum.value() + 1.0);
+
+	std::vector<pascal> t_out(t_in.size());
+	parallel::scan(t_in, t_out, std::plus<>{}, 512, pool);
+	for(uintptr_t i = 0; i < t_in.size(); ++i)
+	{
+		ASSERT_EQ(t_out[i].value(), t_expected[i].value()) << "Index: " << i;
+	}
+
+	//empty input
+	std::vector<pascal> t_empty;
+	ASSERT_EQ(parallel::reduce(t_empty, pascal{2.0}, std::plus<>{}, 512, pool).value(), 2.0);
+	parallel::scan(t_empty, t_empty, std::plus<>{}, 512, pool);
+}
+
+} //namespace unit
@@ -0,0 +1,84 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <span>
+
+#include <unit/pipeline.hpp>
+#include <unit/alias_pressure.hpp>
+
+#include "test_utils.hpp"
+
+namespace unit
+{
+
+TEST(pipeline, stages)
+{
+	constexpr uint32_t sample_count = 10000;
+	constexpr uintptr_t chunk_size = 64;
+
+	pipeline::chunk_queue<kilopascal, chunk_size> t_decoded{4};
+	pipeline::chunk_queue<pascal, chunk_size> t_converted{4};
+	pipeline::chunk_queue<pascal, chunk_size> t_filtered{2};
+	pipeline::stage_counters t_decode_counters;
+	pipeline::stage_counters t_convert_counters;
+	pipeline::stage_counters t_filter_counters;
+	pipeline::stage_counters t_aggregate_counters;
+
+	uint32_t t_next = 0;
+	auto t_decoder = [&](std::span<kilopascal> p_out) -> uintptr_t
+	{
+		uintptr_t t_count = 0;
+		for(; t_count < p_out.size() && t_next < sample_count; ++t_count)
+		{
+			p_out[t_count] = kilopascal{static_cast<double>(t_next++ % 10)};
+		}
+		return t_count;
+	};
+
+	pascal t_total{0.0};
+	{
+		pipeline::runner t_runner;
+		t_runner.spawn([&] { pipeline::decode(t_decoder, t_decoded, t_decode_counters); });
+		t_runner.spawn([&] { pipeline::convert(t_decoded, t_converted, t_convert_counters); });
+		t_runner.spawn([&] { pipeline::filter(t_converted, t_filtered, [](const pascal& p_val) { return p_val.value() >= 5000.0; }, t_filter_counters); });
+
+		t_total = pipeline::aggregate(t_filtered, pascal{0.0}, [](const pascal& p_acc, const pascal& p_val) { return p_acc + p_val; }, t_aggregate_counters);
+	}
+
+	// (5 + 6 + 7 + 8 + 9) kPa for every 10 samples
+	ASSERT_TRUE(closeEnough(t_total.value(), 35000.0 * (sample_count / 10), 1e-6));
+
+	const pipeline::stage_stats t_decode_stats = t_decode_counters.stats();
+	ASSERT_EQ(t_decode_stats.items, uint64_t{sample_count});
+	ASSERT_EQ(t_decode_stats.chunks, uint64_t{(sample_count + chunk_size - 1) / chunk_size});
+	ASSERT_EQ(t_convert_counters.stats().items, uint64_t{sample_count});
+	ASSERT_EQ(t_filter_counters.stats().items, uint64_t{sample_count});
+	ASSERT_EQ(t_aggregate_counters.stats().items, uint64_t{sample_count / 2});
+}
+
+} //namespace unit
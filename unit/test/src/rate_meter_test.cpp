@@ -0,0 +1,101 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cmath>
+#include <type_traits>
+
+#include <unit/rate_meter.hpp>
+#include <unit/alias_digital.hpp>
+#include <unit/alias_time.hpp>
+
+#include "test_utils.hpp"
+
+namespace unit
+{
+
+TEST(rate_meter, result_type)
+{
+	using meter_t = rate_meter<byte>;
+	using expected_type_t = decltype(byte{} / second{});
+
+	ASSERT_TRUE((std::is_same_v<meter_t::rate_t, expected_type_t>));
+	ASSERT_TRUE((std::is_constructible_v<decltype(mebibyte{} / second{}), meter_t::rate_t>));
+}
+
+TEST(rate_meter, rolling_window)
+{
+	rate_meter<byte, second, 8> meter{second{1.0}};
+
+	for(uint32_t i = 0; i < 4; ++i)
+	{
+		meter.record(byte{100.0}, second{10.0 + i});
+		meter.record(byte{ 50.0}, second{10.5 + i});
+	}
+
+	//4 buckets of 150 bytes, from t=10 up to t=14
+	const auto t_rate = meter.rate(second{5.0}, second{14.0});
+	ASSERT_TRUE(closeEnough(t_rate.value(), 600.0 / 4.0, 1e-9));
+	ASSERT_TRUE(closeEnough(meter.total(second{2.0}, second{13.5}).value(), 300.0, 1e-9));
+
+	//buckets that fall out of the window are no longer accounted
+	ASSERT_TRUE(closeEnough(meter.total(second{8.0}, second{30.0}).value(), 0.0, 1e-9));
+
+	//recycled bucket
+	meter.record(byte{10.0}, second{18.2});
+	ASSERT_TRUE(closeEnough(meter.total(second{1.0}, second{18.9}).value(), 10.0, 1e-9));
+	ASSERT_TRUE(closeEnough(meter.total(second{8.0}, second{18.9}).value(), 460.0, 1e-9));
+
+	meter.reset();
+	ASSERT_TRUE(closeEnough(meter.total(second{8.0}, second{18.9}).value(), 0.0, 1e-9));
+}
+
+TEST(rate_meter, bucket_boundary)
+{
+	rate_meter<byte, second, 8> meter{second{1.0}};
+
+	//window of one bucket that has just started, no time has elapsed
+	const auto t_empty = meter.rate(second{1.0}, second{10.0});
+	ASSERT_TRUE(std::isfinite(t_empty.value()));
+	ASSERT_EQ(t_empty.value(), 0.0);
+
+	meter.record(byte{30.0}, second{10.0});
+	const auto t_rate = meter.rate(second{1.0}, second{10.0});
+	ASSERT_TRUE(closeEnough(t_rate.value(), 30.0, 1e-9));
+	ASSERT_TRUE(closeEnough(meter.rate(second{0.5}, second{10.0}).value(), 30.0, 1e-9));
+}
+
+TEST(rate_meter, unit_conversion)
+{
+	rate_meter<byte, milli_second> meter{milli_second{100.0}};
+	meter.record(byte{1024.0 * 1024.0}, milli_second{50.0});
+
+	const decltype(mebibyte{} / second{}) t_rate = meter.rate(milli_second{200.0}, milli_second{100.0});
+	ASSERT_TRUE(closeEnough(t_rate.value(), 10.0, 1e-9));
+}
+
+} //namespace unit
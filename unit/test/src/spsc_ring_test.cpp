@@ -0,0 +1,169 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <unit/spsc_ring.hpp>
+#include <unit/alias_electrical.hpp>
+#include <unit/alias_lenght.hpp>
+
+#include "test_utils.hpp"
+
+namespace unit
+{
+
+TEST(spsc_ring, single_thread)
+{
+	spsc_ring<volt, 8> ring;
+	ASSERT_TRUE(ring.empty());
+
+	for(uint32_t i = 0; i < 8; ++i)
+	{
+		ASSERT_TRUE(ring.push(volt{static_cast<double>(i)}));
+	}
+	ASSERT_FALSE(ring.push(volt{100.0}));
+	ASSERT_EQ(ring.size(), uintptr_t{8});
+
+	volt t_sample;
+	ASSERT_TRUE(ring.pop(t_sample));
+	ASSERT_EQ(t_sample.value(), 0.0);
+
+	//wrapping batch
+	const std::array<volt, 4> t_batch{volt{8.0}, volt{9.0}, volt{10.0}, volt{11.0}};
+	ASSERT_EQ(ring.push(std::span<const volt>{t_batch}), uintptr_t{1});
+
+	std::array<volt, 16> t_out;
+	ASSERT_EQ(ring.pop(std::span{t_out}), uintptr_t{8});
+	for(uint32_t i = 0; i < 8; ++i)
+	{
+		ASSERT_EQ(t_out[i].value(), static_cast<double>(i + 1));
+	}
+	ASSERT_FALSE(ring.pop(t_sample));
+}
+
+TEST(spsc_ring, convert_on_pop)
+{
+	spsc_ring<foot, 4> ring;
+	ring.push(foot{1.0});
+	ring.push(foot{2.0});
+
+	std::array<metre, 4> t_out;
+	ASSERT_EQ(ring.pop(std::span{t_out}), uintptr_t{2});
+	ASSERT_TRUE(closeEnough(t_out[0].value(), 0.3048, 1e-12));
+	ASSERT_TRUE(closeEnough(t_out[1].value(), 0.6096, 1e-12));
+}
+
+TEST(spsc_ring, producer_consumer)
+{
+	constexpr uint32_t sample_count = 200000;
+	spsc_ring<ampere, 1024> ring;
+
+	std::thread t_producer{[&]
+	{
+		std::array<ampere, 64> t_batch;
+		uint32_t t_next = 0;
+		while(t_next < sample_count)
+		{
+			const uint32_t t_count = std::min<uint32_t>(64, sample_count - t_next);
+			for(uint32_t i = 0; i < t_count; ++i)
+			{
+				t_batch[i] = ampere{static_cast<double>(t_next + i)};
+			}
+			uintptr_t t_sent = 0;
+			while(t_sent < t_count)
+			{
+				const uintptr_t t_pushed = ring.push(std::span<const ampere>{t_batch.data() + t_sent, t_count - t_sent});
+				if(t_pushed == 0) std::this_thread::yield();
+				t_sent += t_pushed;
+			}
+			t_next += t_count;
+		}
+	}};
+
+	std::vector<ampere> t_received;
+	t_received.reserve(sample_count);
+	std::array<ampere, 100> t_out;
+	while(t_received.size() < sample_count)
+	{
+		const uintptr_t t_count = ring.pop(std::span{t_out});
+		if(t_count == 0) std::this_thread::yield();
+		t_received.insert(t_received.end(), t_out.begin(), t_out.begin() + t_count);
+	}
+	t_producer.join();
+
+	for(uint32_t i = 0; i < sample_count; ++i)
+	{
+		ASSERT_EQ(t_received[i].value(), static_cast<double>(i));
+	}
+}
+
+TEST(spsc_ring, size_while_running)
+{
+	constexpr uint32_t sample_count = 50000;
+	spsc_ring<ampere, 16> ring;
+	std::atomic<bool> t_done{false};
+
+	std::thread t_producer{[&]
+	{
+		for(uint32_t i = 0; i < sample_count;)
+		{
+			if(ring.push(ampere{static_cast<double>(i)})) ++i;
+			else std::this_thread::yield();
+		}
+	}};
+
+	std::thread t_consumer{[&]
+	{
+		ampere t_sample;
+		for(uint32_t i = 0; i < sample_count;)
+		{
+			if(ring.pop(t_sample)) ++i;
+			else std::this_thread::yield();
+		}
+		t_done.store(true);
+	}};
+
+	//size is observed from a third thread while both ends move
+	uintptr_t t_max = 0;
+	while(!t_done.load())
+	{
+		const uintptr_t t_size = ring.size();
+		t_max = t_size > t_max ? t_size : t_max;
+		std::this_thread::yield();
+	}
+	t_producer.join();
+	t_consumer.join();
+
+	ASSERT_LE(t_max, ring.capacity);
+	ASSERT_TRUE(ring.empty());
+}
+
+} //namespace unit
@@ -35,6 +35,7 @@
 #include <unit/alias_lenght.hpp>
 #include <unit/alias_mass.hpp>
 #include <unit/alias_temperature.hpp>
+#include <unit/standard/multipliers.hpp>
 
 #include "test_utils.hpp"
 
@@ -429,4 +430,57 @@ TEST(type_conversion, subtract_assign)
 	}
 }
 
+TEST(type_conversion, compatibility)
+{
+	ASSERT_TRUE((std::is_constructible_v<metre, foot>));
+	ASSERT_TRUE((std::is_constructible_v<kilogram, pound_av>));
+	ASSERT_FALSE((std::is_constructible_v<metre, kilogram>));
+	ASSERT_FALSE((std::is_constructible_v<foot, pound_av>));
+
+	ASSERT_EQ((_p::conversion_kind_v<metre::unit_pack, metre::unit_pack>), _p::conversion_kind::interchangeable);
+	ASSERT_EQ((_p::conversion_kind_v<metre::unit_pack, foot::unit_pack>), _p::conversion_kind::convertible);
+	ASSERT_EQ((_p::conversion_kind_v<metre::unit_pack, kilogram::unit_pack>), _p::conversion_kind::incompatible);
+}
+
+TEST(type_conversion, metric_id)
+{
+	ASSERT_EQ(_p::metric_id_v<standard::lenght_metric>, _p::metric_hash(u8"lenght"));
+	ASSERT_NE(_p::metric_id_v<standard::lenght_metric>, _p::metric_id_v<standard::mass_metric>);
+	ASSERT_NE(_p::metric_id_v<standard::lenght_metric>, _p::metric_id_v<standard::temperature_metric>);
+	ASSERT_NE(_p::metric_id_v<standard::mass_metric>, _p::metric_id_v<standard::temperature_metric>);
+	ASSERT_TRUE((_p::compare_equal_metric_v<standard::lenght_metric, standard::lenght_metric>));
+	ASSERT_FALSE((_p::compare_equal_metric_v<standard::lenght_metric, standard::mass_metric>));
+	ASSERT_NE((_p::compare_less_metric_v<standard::lenght_metric, standard::mass_metric>), (_p::compare_less_metric_v<standard::mass_metric, standard::lenght_metric>));
+}
+
+TEST(type_conversion, signature)
+{
+	using dim_metre		= _p::dimension<standard::metre, 1>;
+	using dim_foot		= _p::dimension<standard::foot, 1>;
+	using dim_mass		= _p::dimension<standard::si_mass, 1>;
+	using dim_mass_inv	= _p::dimension<standard::si_mass, -1>;
+
+	constexpr auto signature = make_unit<double, core::pack<dim_mass, dim_metre>, core::pack<multi::kilo<1>>>::type::unit_pack::signature;
+	ASSERT_EQ(signature.dimensions.size(), 2);
+	ASSERT_EQ(signature.scalars.size(), 1);
+	ASSERT_EQ(signature.scalars[0].power, 3);
+
+	constexpr auto inverse = _p::invert_signature_v<signature>;
+	ASSERT_EQ(inverse.dimensions[0].rank, -1);
+	ASSERT_EQ(inverse.dimensions[1].rank, -1);
+	ASSERT_EQ(inverse.scalars[0].power, -3);
+
+	//ranks cancel out
+	constexpr auto merged = _p::merge_dimensions_v<false, signature.dimensions, _p::dimension_entries_v<core::pack<dim_mass_inv>>>;
+	ASSERT_EQ(merged.size(), 1);
+	ASSERT_TRUE((merged[0].metric == _p::metric_id_v<standard::lenght_metric>));
+
+	//metre and foot are kept apart unless merging by metric
+	constexpr auto feet = _p::dimension_entries_v<core::pack<dim_foot>>;
+	ASSERT_EQ((_p::merge_dimensions_v<true, signature.dimensions, feet>.size()), 3);
+	ASSERT_EQ((_p::merge_dimensions_v<false, signature.dimensions, feet>.size()), 2);
+	ASSERT_TRUE((_p::conflicting_dimensions_v<signature.dimensions, feet>));
+	ASSERT_FALSE((_p::compatible_dimensions_v<signature.dimensions, feet>));
+}
+
 } //namespace unit
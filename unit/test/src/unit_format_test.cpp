@@ -0,0 +1,109 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <array>
+#include <charconv>
+#include <string_view>
+
+#include <unit/unit_format.hpp>
+#include <unit/unit_parser.hpp>
+
+#include "test_utils.hpp"
+
+namespace unit
+{
+
+namespace
+{
+	template<typename Unit_t, typename... Args>
+	std::string_view format_unit(std::array<char, 64>& p_buffer, const Unit_t& p_unit, Args... p_args)
+	{
+		const std::to_chars_result t_result = to_chars(p_buffer.data(), p_buffer.data() + p_buffer.size(), p_unit, p_args...);
+		EXPECT_EQ(t_result.ec, std::errc{});
+		return std::string_view{p_buffer.data(), static_cast<uintptr_t>(t_result.ptr - p_buffer.data())};
+	}
+}
+
+TEST(unit_format, symbol)
+{
+	ASSERT_EQ(unit_symbol_v<metre>, "m");
+	ASSERT_EQ(unit_symbol_v<newton>, "N");
+	ASSERT_EQ(unit_symbol_v<celcius>, "degC");
+	ASSERT_EQ(unit_symbol_v<fahrenheit>, "degF");
+	ASSERT_EQ(unit_symbol_v<kilo_metre>, "km");
+	ASSERT_EQ(unit_symbol_v<square_kilo_metre>, "km^2");
+	ASSERT_EQ(unit_symbol_v<kilometre_per_hour>, "km/h");
+	ASSERT_EQ(unit_symbol_v<mebibyte>, "MiB");
+	ASSERT_EQ(unit_symbol_v<metre_per_second_squared>, "m/s^2");
+	ASSERT_EQ(unit_symbol_v<square_foot>, "ft^2");
+	ASSERT_EQ(unit_symbol_v<metre_t<float>>, "m");
+	ASSERT_EQ(unit_symbol_v<light_second>, "ls");
+	ASSERT_EQ(unit_symbol_v<grad>, "gon");
+	ASSERT_EQ(unit_symbol_v<kilopascal>, "kPa");
+	ASSERT_EQ(_p::unit_symbol<kilopascal>::factor, 1.l);
+
+	//symbols round trip through the parser
+	unit_descriptor t_descriptor;
+	ASSERT_EQ(parse_unit(unit_symbol_v<pound_av_per_cubic_feet>, t_descriptor), std::errc{});
+	ASSERT_EQ(t_descriptor.signature(), unit_descriptor_v<pound_av_per_cubic_feet>.signature());
+	ASSERT_TRUE(closeEnough(t_descriptor.gauge(), unit_descriptor_v<pound_av_per_cubic_feet>.gauge(), 1e-12));
+}
+
+TEST(unit_format, factor)
+{
+	//doublet has no symbol, values are written in bits
+	ASSERT_EQ(unit_symbol_v<doublet>, "bit");
+	ASSERT_EQ(_p::unit_symbol<doublet>::factor, 16.l);
+
+	std::array<char, 64> t_buffer;
+	ASSERT_EQ(format_unit(t_buffer, doublet{2.0}), "32 bit");
+}
+
+TEST(unit_format, to_chars)
+{
+	std::array<char, 64> t_buffer;
+	ASSERT_EQ(format_unit(t_buffer, metre{1.5}), "1.5 m");
+	ASSERT_EQ(format_unit(t_buffer, kilometre_per_hour{3.14159}, std::chars_format::fixed, 2), "3.14 km/h");
+	ASSERT_EQ(format_unit(t_buffer, celcius{21.5}, std::chars_format::fixed, 1), "21.5 degC");
+	ASSERT_EQ(format_unit(t_buffer, second{1500.0}, std::chars_format::scientific), "1.5e+03 s");
+	ASSERT_EQ(format_unit(t_buffer, kilopascal{1.0}), "1 kPa");
+
+	std::array<char, 5> t_small;
+	ASSERT_EQ(to_chars(t_small.data(), t_small.data() + t_small.size(), kilometre_per_hour{1.0}).ec, std::errc::value_too_large);
+	ASSERT_EQ(to_chars(t_small.data(), t_small.data() + t_small.size(), metre{1.0}).ec, std::errc{});
+}
+
+#if defined(__cpp_lib_format)
+TEST(unit_format, formatter)
+{
+	ASSERT_EQ(std::format("{:.2f}", kilometre_per_hour{3.14159}), "3.14 km/h");
+	ASSERT_EQ(std::format("{}", celcius{21.5}), "21.5 degC");
+}
+#endif
+
+} //namespace unit
@@ -0,0 +1,74 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <type_traits>
+
+#include <unit/unit_literal.hpp>
+#include <unit/standard/si_prefix.hpp>
+
+#include "test_utils.hpp"
+
+namespace unit
+{
+
+TEST(unit_literal, parse_t)
+{
+	ASSERT_TRUE((std::is_same_v<parse_t<"m">, metre>));
+	ASSERT_TRUE((std::is_same_v<parse_t<"km">, kilo_metre>));
+	ASSERT_TRUE((std::is_same_v<parse_t<"m/s">, metre_per_second>));
+	ASSERT_TRUE((std::is_same_v<parse_t<"km/h">, kilometre_per_hour>));
+	ASSERT_TRUE((std::is_same_v<parse_t<"m/s^2">, metre_per_second_squared>));
+	ASSERT_TRUE((std::is_same_v<parse_t<"kg*m/s^2">, newton>));
+	ASSERT_TRUE((std::is_same_v<parse_t<"kg * m / s / s">, newton>));
+	ASSERT_TRUE((std::is_same_v<parse_t<"m^2">, square_metre>));
+	ASSERT_TRUE((std::is_same_v<parse_t<"MiB">, mebibyte>));
+	ASSERT_TRUE((std::is_same_v<parse_t<"1/s">, hertz>));
+	ASSERT_TRUE((std::is_same_v<parse_t<"degC">, celcius>));
+	ASSERT_TRUE((std::is_same_v<parse_t<"m", float>, metre_t<float>>));
+
+	using kilo_newton_metre = typename make_unit<double,
+		core::pack<_p::dimension<standard::si_mass, 1>, _p::dimension<standard::metre, 2>, _p::dimension<standard::second, -2>>,
+		core::pack<multi::kilo<1>>>::type;
+	ASSERT_TRUE((std::is_same_v<parse_t<"kN*m">, kilo_newton_metre>));
+}
+
+TEST(unit_literal, literal)
+{
+	using namespace unit::literals;
+
+	constexpr auto acceleration = 9.8 * "m/s^2"_u;
+	ASSERT_TRUE((std::is_same_v<std::remove_const_t<decltype(acceleration)>, metre_per_second_squared>));
+	ASSERT_EQ(acceleration.value(), 9.8);
+
+	const kilometre_per_hour speed = 36.0 * "km/h"_u;
+	ASSERT_TRUE(closeEnough(metre_per_second{speed}.value(), 10.0, 1e-12));
+
+	ASSERT_EQ(("degC"_u).value(), 1.0);
+}
+
+} //namespace unit
@@ -0,0 +1,196 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include <unit/unit_parser.hpp>
+
+#include "test_utils.hpp"
+
+namespace unit
+{
+
+namespace
+{
+	unit_descriptor parse_or_fail(std::string_view p_text)
+	{
+		unit_descriptor t_descriptor;
+		EXPECT_EQ(parse_unit(p_text, t_descriptor), std::errc{}) << p_text;
+		return t_descriptor;
+	}
+
+	std::errc parse_error(std::string_view p_text)
+	{
+		unit_descriptor t_descriptor;
+		return parse_unit(p_text, t_descriptor);
+	}
+}
+
+TEST(unit_parser, symbols)
+{
+	for(uintptr_t i = 0; i < _p::symbol_entries.size(); ++i)
+	{
+		ASSERT_EQ(_p::find_symbol(_p::symbol_entries[i].symbol), i) << _p::symbol_entries[i].symbol;
+	}
+	for(uintptr_t i = 0; i < _p::prefix_entries.size(); ++i)
+	{
+		ASSERT_EQ(_p::find_prefix(_p::prefix_entries[i].symbol), i) << _p::prefix_entries[i].symbol;
+	}
+	ASSERT_EQ(_p::find_symbol("meter"), _p::no_symbol);
+	ASSERT_EQ(_p::find_symbol(""), _p::no_symbol);
+}
+
+TEST(unit_parser, descriptor)
+{
+	ASSERT_EQ(parse_or_fail("m").signature(), unit_descriptor_v<metre>.signature());
+	ASSERT_TRUE(closeEnough(parse_or_fail("km").gauge(), 1000.0, 1e-9));
+
+	const unit_descriptor newton_d = parse_or_fail("kg*m/s^2");
+	ASSERT_EQ(newton_d.signature(), unit_descriptor_v<newton>.signature());
+	ASSERT_TRUE(closeEnough(newton_d.gauge(), 1.0, 1e-12));
+	ASSERT_EQ(parse_or_fail("kg * m / s / s").signature(), newton_d.signature());
+	ASSERT_EQ(parse_or_fail("kg*m*s^-2").signature(), newton_d.signature());
+
+	const unit_descriptor kmh = parse_or_fail("km/h");
+	ASSERT_EQ(kmh.signature(), unit_descriptor_v<kilometre_per_hour>.signature());
+	ASSERT_TRUE(closeEnough(kmh.gauge(), 1.0 / 3.6, 1e-12));
+
+	ASSERT_TRUE(closeEnough(parse_or_fail("MiB").gauge(), 8.0 * 1024.0 * 1024.0, 1e-6));
+	ASSERT_TRUE(closeEnough(parse_or_fail("MB").gauge(), 8.0e6, 1e-6));
+	ASSERT_TRUE(closeEnough(parse_or_fail("km^2").gauge(), 1.0e6, 1e-6));
+	ASSERT_TRUE(closeEnough(parse_or_fail("\xC2\xB5m").gauge(), 1.0e-6, 1e-18));
+	ASSERT_TRUE(closeEnough(parse_or_fail("um").gauge(), 1.0e-6, 1e-18));
+	ASSERT_TRUE(closeEnough(parse_or_fail("dam").gauge(), 10.0, 1e-12));
+	ASSERT_TRUE(closeEnough(parse_or_fail("mAh").gauge(), 3.6, 1e-12));
+	ASSERT_TRUE(closeEnough(parse_or_fail("min").gauge(), 60.0, 1e-12));
+	ASSERT_TRUE(closeEnough(parse_or_fail("ms").gauge(), 1.0e-3, 1e-15));
+	ASSERT_EQ(parse_or_fail("cd"), unit_descriptor_v<candela>);
+	ASSERT_EQ(parse_or_fail("ls"), unit_descriptor_v<light_second>);
+	ASSERT_EQ(parse_or_fail("gon"), unit_descriptor_v<grad>);
+	ASSERT_EQ(parse_or_fail("1/s").signature(), unit_descriptor_v<hertz>.signature());
+
+	const unit_descriptor celcius_d = parse_or_fail("degC");
+	ASSERT_TRUE(celcius_d.has_offset());
+	ASSERT_TRUE(closeEnough(celcius_d.offset(), 273.15, 1e-12));
+}
+
+TEST(unit_parser, errors)
+{
+	ASSERT_EQ(parse_error(""), std::errc::invalid_argument);
+	ASSERT_EQ(parse_error("meter"), std::errc::invalid_argument);
+	ASSERT_EQ(parse_error("kft"), std::errc::invalid_argument);
+	ASSERT_EQ(parse_error("KiN"), std::errc::invalid_argument);
+	ASSERT_EQ(parse_error("m/"), std::errc::invalid_argument);
+	ASSERT_EQ(parse_error("m^"), std::errc::invalid_argument);
+	ASSERT_EQ(parse_error("m+s"), std::errc::invalid_argument);
+	ASSERT_EQ(parse_error("degC*m"), std::errc::invalid_argument);
+	ASSERT_EQ(parse_error("degC^2"), std::errc::invalid_argument);
+	ASSERT_EQ(parse_error("1/degC"), std::errc::invalid_argument);
+	ASSERT_EQ(parse_error("m^128"), std::errc::result_out_of_range);
+	ASSERT_EQ(parse_error("m^100*m^100"), std::errc::result_out_of_range);
+	ASSERT_EQ(parse_error("m^-128"), std::errc{});
+	ASSERT_EQ(parse_error("1/m^128"), std::errc{});
+	ASSERT_EQ(parse_error("m^-129"), std::errc::result_out_of_range);
+	ASSERT_EQ(parse_error("1/m^-128"), std::errc::result_out_of_range);
+
+	//ranks can not wrap around however many terms there are
+	std::string t_long = "m";
+	for(uint32_t i = 0; i < 300; ++i)
+	{
+		t_long += "*m^127";
+	}
+	ASSERT_EQ(parse_error(t_long), std::errc::result_out_of_range);
+
+	unit_descriptor t_descriptor = unit_descriptor_v<second>;
+	ASSERT_NE(parse_unit("m/", t_descriptor), std::errc{});
+	ASSERT_EQ(t_descriptor, unit_descriptor_v<second>);
+}
+
+TEST(unit_parser, static_check)
+{
+	affine_conversion t_conversion;
+	ASSERT_EQ(parse_unit_conversion<metre_per_second>("km/h", t_conversion), std::errc{});
+	ASSERT_TRUE(closeEnough(t_conversion.apply(36.0), 10.0, 1e-12));
+
+	ASSERT_EQ(parse_unit_conversion<celcius>("degF", t_conversion), std::errc{});
+	ASSERT_TRUE(closeEnough(t_conversion.apply(212.0), 100.0, 1e-9));
+
+	ASSERT_EQ(parse_unit_conversion<metre>("s", t_conversion), std::errc::invalid_argument);
+
+	static_assert([]
+		{
+			unit_descriptor t_descriptor;
+			return parse_unit("kN*m", t_descriptor) == std::errc{} && t_descriptor.signature() == unit_descriptor_v<joule>.signature();
+		}());
+}
+
+TEST(unit_parser, from_chars)
+{
+	const auto parse = []<typename Unit_t>(std::string_view p_text, Unit_t& p_out)
+		{
+			return unit::from_chars(p_text.data(), p_text.data() + p_text.size(), p_out);
+		};
+
+	metre t_metre;
+	ASSERT_EQ(parse("12.5 km", t_metre).ec, std::errc{});
+	ASSERT_TRUE(closeEnough(t_metre.value(), 12500.0, 1e-9));
+
+	ASSERT_EQ(parse("3ft", t_metre).ec, std::errc{});
+	ASSERT_TRUE(closeEnough(t_metre.value(), 0.9144, 1e-12));
+
+	ASSERT_EQ(parse("4.2e3 mm", t_metre).ec, std::errc{});
+	ASSERT_TRUE(closeEnough(t_metre.value(), 4.2, 1e-12));
+
+	const std::string_view t_list = "7 m, 8 m";
+	const std::from_chars_result t_first = parse(t_list, t_metre);
+	ASSERT_EQ(t_first.ec, std::errc{});
+	ASSERT_EQ(*t_first.ptr, ',');
+	ASSERT_EQ(t_metre.value(), 7.0);
+
+	kilometre_per_hour t_speed;
+	ASSERT_EQ(parse("10 m/s", t_speed).ec, std::errc{});
+	ASSERT_TRUE(closeEnough(t_speed.value(), 36.0, 1e-12));
+
+	celcius t_temperature;
+	ASSERT_EQ(parse("212 degF", t_temperature).ec, std::errc{});
+	ASSERT_TRUE(closeEnough(t_temperature.value(), 100.0, 1e-9));
+
+	t_metre = metre{1.0};
+	const std::string_view t_missing = "12.5";
+	const std::from_chars_result t_no_suffix = parse(t_missing, t_metre);
+	ASSERT_EQ(t_no_suffix.ec, std::errc::invalid_argument);
+	ASSERT_EQ(t_no_suffix.ptr, t_missing.data());
+	ASSERT_EQ(parse("12.5 s", t_metre).ec, std::errc::invalid_argument);
+	ASSERT_EQ(parse("12.5 meter", t_metre).ec, std::errc::invalid_argument);
+	ASSERT_EQ(parse("km", t_metre).ec, std::errc::invalid_argument);
+	ASSERT_EQ(t_metre.value(), 1.0);
+}
+
+} //namespace unit
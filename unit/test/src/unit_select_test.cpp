@@ -0,0 +1,83 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///		Copyright (c) Tiago Miguel Oliveira Freire
+///
+///		Permission is hereby granted, free of charge, to any person obtaining a copy
+///		of this software and associated documentation files (the "Software"), to deal
+///		in the Software without restriction, including without limitation the rights
+///		to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+///		copies of the Software, and to permit persons to whom the Software is
+///		furnished to do so, subject to the following conditions:
+///
+///		The above copyright notice and this permission notice shall be included in all
+///		copies or substantial portions of the Software.
+///
+///		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+///		IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+///		FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+///		AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+///		LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+///		OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+///		SOFTWARE.
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <array>
+#include <span>
+#include <string_view>
+
+#include <unit/unit_select.hpp>
+#include <unit/alias_lenght.hpp>
+#include <unit/alias_temperature.hpp>
+
+#include "test_utils.hpp"
+
+namespace unit
+{
+
+TEST(unit_select, visit_as)
+{
+	const metre t_distance{1852.0};
+
+	const auto value_of = [](const auto& p_unit) { return static_cast<double>(p_unit.value()); };
+
+	ASSERT_EQ((visit_as<metre, foot, mile, nautical_mile>(0, t_distance, value_of)), 1852.0);
+	ASSERT_TRUE(closeEnough(visit_as<metre, foot, mile, nautical_mile>(1, t_distance, value_of), 1852.0 / 0.3048, 1e-9));
+	ASSERT_TRUE(closeEnough(visit_as<metre, foot, mile, nautical_mile>(2, t_distance, value_of), 1852.0 / 1609.344, 1e-12));
+	ASSERT_TRUE(closeEnough(visit_as<metre, foot, mile, nautical_mile>(3, t_distance, value_of), 1.0, 1e-12));
+
+	//alternatives are statically typed
+	const auto is_mile = [](const auto& p_unit) { return std::is_same_v<std::remove_cvref_t<decltype(p_unit)>, mile>; };
+	ASSERT_FALSE((visit_as<metre, mile>(0, t_distance, is_mile)));
+	ASSERT_TRUE((visit_as<metre, mile>(1, t_distance, is_mile)));
+
+	//offset units
+	ASSERT_TRUE(closeEnough(visit_as<kelvin, celcius, rankine>(0, celcius{100.0}, value_of), 373.15, 1e-9));
+	ASSERT_TRUE(closeEnough(visit_as<kelvin, celcius, rankine>(2, celcius{100.0}, value_of), 671.67, 1e-9));
+}
+
+TEST(unit_select, convert_as)
+{
+	static_assert(unit_factors_v<metre, metre, kilo_metre>[0] == 1.0);
+	static_assert(unit_factors_v<metre, metre, kilo_metre>[1] == 0.001);
+
+	const std::array<metre, 3> t_values{metre{0.0}, metre{1609.344}, metre{3218.688}};
+	std::array<double, 3> t_out{};
+
+	ASSERT_TRUE((convert_as<metre, foot, mile, nautical_mile>(2, std::span<const metre>{t_values}, std::span{t_out})));
+	ASSERT_EQ(t_out[0], 0.0);
+	ASSERT_TRUE(closeEnough(t_out[1], 1.0, 1e-12));
+	ASSERT_TRUE(closeEnough(t_out[2], 2.0, 1e-12));
+
+	ASSERT_TRUE((convert_as<metre, foot, mile, nautical_mile>(1, std::span<const metre>{t_values}, std::span{t_out})));
+	ASSERT_TRUE(closeEnough(t_out[1], 5280.0, 1e-9));
+
+	ASSERT_FALSE((convert_as<metre, foot>(2, std::span<const metre>{t_values}, std::span{t_out})));
+	ASSERT_FALSE((convert_as<metre, foot>(0, std::span<const metre>{t_values}, std::span{t_out}.first(2))));
+}
+
+} //namespace unit